@@ -49,6 +49,7 @@ class Block {
 	public:
 		Block(string const& id) {
 			this->id = id;
+			this->numerical_id = Block::NUMERICAL_ID_UNDEF;
 			this->layer = -1;
 			this->power_density= 0.0;
 			this->AR.min = AR.max = 1.0;
@@ -61,6 +62,13 @@ class Block {
 	// public data, functions
 	public:
 		string id;
+		// dense index of block w/in parsed blocks, to be used for any
+		// comparison and look-up; the string id is only to be used for IO
+		int numerical_id;
+		// numerical ids of blocks not parsed as regular blocks, i.e., pins, TSVs
+		// and the dummy reference block
+		static constexpr int NUMERICAL_ID_UNDEF = -1;
+		static constexpr int NUMERICAL_ID_RBOD = -2;
 		mutable int layer;
 
 		// flag to monitor placement; also required for alignment handling
@@ -127,7 +135,7 @@ class Block {
 			return this->power_density * this->bb.area * 1.0e-6;
 		}
 
-		// search blocks
+		// search blocks; by string id, only to be used for IO
 		inline static Block const* findBlock(string const& id, vector<Block> const& container) {
 
 			for (Block const& b : container) {
@@ -138,6 +146,15 @@ class Block {
 
 			return nullptr;
 		};
+		// search blocks; by numerical id
+		inline static Block const* findBlock(int const& numerical_id, vector<Block> const& container) {
+
+			if (0 <= numerical_id && numerical_id < static_cast<int>(container.size())) {
+				return &container[numerical_id];
+			}
+
+			return nullptr;
+		};
 
 		friend ostream& operator<< (ostream& out, AlignmentStatus const& status) {
 
@@ -176,7 +193,7 @@ class Pin : public Block {
 		Pin (string const& id) : Block(id) {
 		};
 
-		// search pins
+		// search pins; by string id, only to be used for IO
 		inline static Pin const* findPin(string const& id, vector<Pin> const& container) {
 
 			for (Pin const& b : container) {
@@ -199,11 +216,15 @@ class TSV_Group : public Block {
 
 			this->TSVs_count = TSVs_count;
 			this->layer = layer;
+			this->active = false;
 		};
 
 	// public data, functions
 	public:
 		int TSVs_count;
+		// flag for groups in use; groups are preallocated, e.g., for vertical
+		// buses of all alignment requests, but only in use for some of them
+		bool active;
 };
 
 // derived dummy block "RBOD" as ``Reference Block On Die'' for fixed offsets
@@ -216,6 +237,8 @@ class RBOD : public Block {
 	public:
 		RBOD () : Block("RBOD") {
 
+			this->numerical_id = Block::NUMERICAL_ID_RBOD;
+
 			this->bb.ll.x = 0.0;
 			this->bb.ll.y = 0.0;
 			this->bb.ur.x = 0.0;
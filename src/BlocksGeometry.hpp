@@ -0,0 +1,127 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar blocks geometry, contiguous store of blocks' placement
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_BLOCKS_GEOMETRY
+#define _CORBLIVAR_BLOCKS_GEOMETRY
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "Block.hpp"
+// forward declarations, if any
+
+// Geometry and layer assignment of all blocks, held as structure of arrays and indexed
+// by the blocks' numerical ids. Cost functions iterate over the blocks' coordinates
+// only, thus they shall read them from here, w/o passing the cold data of the blocks
+// (ids, power, AR, backup and best bbs, etc.) through the cache. The blocks
+// themselves remain the reference for placement; after each layout generation, the
+// store is updated only for the blocks which were placed or packed, see
+// FloorPlanner::generateLayout
+class BlocksGeometry {
+	// constructors, destructors, if any non-implicit
+	public:
+		BlocksGeometry() {
+			this->valid = false;
+		};
+
+	// public data, functions
+	public:
+		vector<double> ll_x, ll_y;
+		vector<double> ur_x, ur_y;
+		vector<double> w, h;
+		vector<int> layer;
+		// blocks w/ changed geometry or layer since the changes were last
+		// cleared; as flags and as list
+		vector<bool> changed_flags;
+		vector<unsigned> changed;
+		// flag whether the store reflects all blocks; to be reset whenever
+		// blocks are placed otherwise than by layout generation
+		bool valid;
+
+		inline unsigned size() const {
+			return this->layer.size();
+		};
+
+		// (re-)init store for blocks; all blocks are initially unplaced
+		inline void init(unsigned const& blocks) {
+			this->ll_x.assign(blocks, 0.0);
+			this->ll_y.assign(blocks, 0.0);
+			this->ur_x.assign(blocks, 0.0);
+			this->ur_y.assign(blocks, 0.0);
+			this->w.assign(blocks, 0.0);
+			this->h.assign(blocks, 0.0);
+			this->layer.assign(blocks, -1);
+			this->changed_flags.assign(blocks, false);
+			this->changed.clear();
+			this->changed.reserve(blocks);
+		};
+
+		// update store w/ block's current geometry and layer; memorize block
+		// as changed if required
+		inline void update(Block const& block) {
+			unsigned const b = block.numerical_id;
+
+			if (this->layer[b] == block.layer &&
+					this->ll_x[b] == block.bb.ll.x && this->ll_y[b] == block.bb.ll.y &&
+					this->ur_x[b] == block.bb.ur.x && this->ur_y[b] == block.bb.ur.y) {
+				return;
+			}
+
+			if (!this->changed_flags[b]) {
+				this->changed_flags[b] = true;
+				this->changed.push_back(b);
+			}
+
+			this->ll_x[b] = block.bb.ll.x;
+			this->ll_y[b] = block.bb.ll.y;
+			this->ur_x[b] = block.bb.ur.x;
+			this->ur_y[b] = block.bb.ur.y;
+			this->w[b] = block.bb.w;
+			this->h[b] = block.bb.h;
+			this->layer[b] = block.layer;
+		};
+
+		// update store w/ all blocks' current geometry and layer
+		inline void update(vector<Block> const& blocks) {
+
+			if (this->size() != blocks.size()) {
+				this->init(blocks.size());
+			}
+
+			for (Block const& block : blocks) {
+				this->update(block);
+			}
+
+			this->valid = true;
+		};
+
+		// reset list of changed blocks
+		inline void clearChanged() {
+
+			for (unsigned const& b : this->changed) {
+				this->changed_flags[b] = false;
+			}
+			this->changed.clear();
+		};
+};
+
+#endif
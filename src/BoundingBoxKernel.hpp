@@ -0,0 +1,258 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar bounding-box kernel, per-layer boxes of nets' blocks
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_BOUNDING_BOX_KERNEL
+#define _CORBLIVAR_BOUNDING_BOX_KERNEL
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "Netlist.hpp"
+#include "Rect.hpp"
+// forward declarations, if any
+
+// Kernel for the bounding boxes of a net's blocks on each layer, based on the blocks'
+// geometry and layer as laid out contiguously in the netlist. Provides a scalar and
+// an AVX2 implementation; the latter processes four blocks at once and selects blocks
+// of each layer by masks. The AVX2 implementation is compiled for all x86 targets,
+// independent of the compiler flags, and is selected at startup if the CPU supports
+// it. Both provide the very same results, since only min / max operations are
+// applied
+class BoundingBoxKernel {
+	// debugging code switch (private)
+	private:
+		// enforce scalar implementation
+		static constexpr bool DBG_SCALAR = false;
+
+	// private data, functions
+	private:
+		// max range of layers handled by the AVX2 implementation
+		static constexpr int AVX2_LAYERS = 8;
+		// min count of net's blocks to be handled by the AVX2 implementation
+		static constexpr unsigned AVX2_MIN_BLOCKS = 16;
+
+	// public data, functions
+	public:
+		// determine layer boundaries, i.e., lowest and uppermost layer, of net's
+		// blocks, the count of blocks on the uppermost layer, and the bounding
+		// boxes of the blocks on each layer; bounding boxes of layers in between
+		// w/o any blocks are not modified, others are extended by the blocks. The
+		// net is expected to have some blocks
+		typedef void (*Kernel)(Netlist const& netlist, unsigned const& net, vector<Rect>& bbs,
+				int& layer_bottom, int& layer_top, unsigned& blocks_layer_top);
+
+		inline static void determLayerBoxes(Netlist const& netlist, unsigned const& net, vector<Rect>& bbs,
+				int& layer_bottom, int& layer_top, unsigned& blocks_layer_top) {
+
+			// kernel is selected once, during first call; thread-safe
+			// initialization of static local variables is guaranteed by C++11
+			static Kernel const kernel = BoundingBoxKernel::selectKernel();
+
+			kernel(netlist, net, bbs, layer_bottom, layer_top, blocks_layer_top);
+		};
+
+		inline static bool AVX2Available() {
+#if defined(__x86_64__) || defined(__i386__)
+			return __builtin_cpu_supports("avx2");
+#else
+			return false;
+#endif
+		};
+
+		inline static Kernel selectKernel() {
+#if defined(__x86_64__) || defined(__i386__)
+			if (!BoundingBoxKernel::DBG_SCALAR && BoundingBoxKernel::AVX2Available()) {
+				return &BoundingBoxKernel::determLayerBoxesAVX2;
+			}
+#endif
+			return &BoundingBoxKernel::determLayerBoxesScalar;
+		};
+
+		inline static void determLayerBoxesScalar(Netlist const& netlist, unsigned const& net, vector<Rect>& bbs,
+				int& layer_bottom, int& layer_top, unsigned& blocks_layer_top) {
+			unsigned b;
+			int i;
+
+			layer_bottom = layer_top = netlist.blocks_layer[netlist.blocksBegin(net)];
+			blocks_layer_top = 0;
+
+			for (b = netlist.blocksBegin(net); b < netlist.blocksEnd(net); b++) {
+
+				i = netlist.blocks_layer[b];
+
+				Rect& bb = bbs[i];
+				bb.ll.x = min(bb.ll.x, netlist.blocks_ll_x[b]);
+				bb.ll.y = min(bb.ll.y, netlist.blocks_ll_y[b]);
+				bb.ur.x = max(bb.ur.x, netlist.blocks_ur_x[b]);
+				bb.ur.y = max(bb.ur.y, netlist.blocks_ur_y[b]);
+
+				layer_bottom = min(layer_bottom, i);
+
+				if (i > layer_top) {
+					layer_top = i;
+					blocks_layer_top = 1;
+				}
+				else if (i == layer_top) {
+					blocks_layer_top++;
+				}
+			}
+		};
+
+#if defined(__x86_64__) || defined(__i386__)
+		__attribute__((target("avx2")))
+		inline static void determLayerBoxesAVX2(Netlist const& netlist, unsigned const& net, vector<Rect>& bbs,
+				int& layer_bottom, int& layer_top, unsigned& blocks_layer_top) {
+			unsigned b, begin, end;
+			int i, l;
+			int const* layer;
+			double const *ll_x, *ll_y, *ur_x, *ur_y;
+			array<int,8> layers8_;
+			array<double,4> ll_x4_, ll_y4_, ur_x4_, ur_y4_;
+			array<long long,4> count4_;
+
+			begin = netlist.blocksBegin(net);
+			end = netlist.blocksEnd(net);
+
+			layer = netlist.blocks_layer.data();
+			ll_x = netlist.blocks_ll_x.data();
+			ll_y = netlist.blocks_ll_y.data();
+			ur_x = netlist.blocks_ur_x.data();
+			ur_y = netlist.blocks_ur_y.data();
+
+			// nets w/ only few blocks are handled by the scalar
+			// implementation; the overhead of SIMD vectors doesn't pay off
+			if (end - begin < BoundingBoxKernel::AVX2_MIN_BLOCKS) {
+				BoundingBoxKernel::determLayerBoxesScalar(netlist, net, bbs, layer_bottom, layer_top, blocks_layer_top);
+				return;
+			}
+
+			// layer boundaries; eight layers at once
+			layer_bottom = layer_top = layer[begin];
+
+			b = begin;
+			__m256i bottom8 = _mm256_set1_epi32(layer_bottom);
+			__m256i top8 = _mm256_set1_epi32(layer_top);
+			for (; b + 8 <= end; b += 8) {
+				__m256i layers8 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(layer + b));
+				bottom8 = _mm256_min_epi32(bottom8, layers8);
+				top8 = _mm256_max_epi32(top8, layers8);
+			}
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(layers8_.data()), bottom8);
+			for (i = 0; i < 8; i++) {
+				layer_bottom = min(layer_bottom, layers8_[i]);
+			}
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(layers8_.data()), top8);
+			for (i = 0; i < 8; i++) {
+				layer_top = max(layer_top, layers8_[i]);
+			}
+			// scalar fallback, also handles remaining blocks
+			for (; b < end; b++) {
+				layer_bottom = min(layer_bottom, layer[b]);
+				layer_top = max(layer_top, layer[b]);
+			}
+
+			// the vectorized boxes are kept in registers for a limited range of
+			// layers; fallback to scalar implementation for nets spanning more
+			// layers
+			if (layer_top - layer_bottom >= BoundingBoxKernel::AVX2_LAYERS) {
+				BoundingBoxKernel::determLayerBoxesScalar(netlist, net, bbs, layer_bottom, layer_top, blocks_layer_top);
+				return;
+			}
+
+			// bounding boxes on each layer, in one pass over the blocks; four
+			// blocks at once, blocks on other layers are masked out by
+			// neutral coordinates
+			__m256d min4 = _mm256_set1_pd(numeric_limits<double>::max());
+			__m256d max4 = _mm256_set1_pd(numeric_limits<double>::lowest());
+			__m256d ll_x4[BoundingBoxKernel::AVX2_LAYERS], ll_y4[BoundingBoxKernel::AVX2_LAYERS];
+			__m256d ur_x4[BoundingBoxKernel::AVX2_LAYERS], ur_y4[BoundingBoxKernel::AVX2_LAYERS];
+			__m256i count4 = _mm256_setzero_si256();
+			__m128i top4 = _mm_set1_epi32(layer_top);
+
+			for (l = 0; l <= layer_top - layer_bottom; l++) {
+				ll_x4[l] = ll_y4[l] = min4;
+				ur_x4[l] = ur_y4[l] = max4;
+			}
+
+			b = begin;
+			for (; b + 4 <= end; b += 4) {
+
+				__m128i layers4 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(layer + b));
+				__m256d block_ll_x4 = _mm256_loadu_pd(ll_x + b);
+				__m256d block_ll_y4 = _mm256_loadu_pd(ll_y + b);
+				__m256d block_ur_x4 = _mm256_loadu_pd(ur_x + b);
+				__m256d block_ur_y4 = _mm256_loadu_pd(ur_y + b);
+
+				for (l = 0; l <= layer_top - layer_bottom; l++) {
+
+					// mask of blocks on current layer; 32-bit comparison
+					// results are extended to 64-bit lanes
+					__m256d mask4 = _mm256_castsi256_pd(_mm256_cvtepi32_epi64(
+								_mm_cmpeq_epi32(layers4, _mm_set1_epi32(layer_bottom + l))));
+
+					ll_x4[l] = _mm256_min_pd(ll_x4[l], _mm256_blendv_pd(min4, block_ll_x4, mask4));
+					ll_y4[l] = _mm256_min_pd(ll_y4[l], _mm256_blendv_pd(min4, block_ll_y4, mask4));
+					ur_x4[l] = _mm256_max_pd(ur_x4[l], _mm256_blendv_pd(max4, block_ur_x4, mask4));
+					ur_y4[l] = _mm256_max_pd(ur_y4[l], _mm256_blendv_pd(max4, block_ur_y4, mask4));
+				}
+
+				// count blocks on uppermost layer; comparison results are -1
+				count4 = _mm256_sub_epi64(count4, _mm256_cvtepi32_epi64(_mm_cmpeq_epi32(layers4, top4)));
+			}
+
+			// reduce SIMD vectors
+			for (l = 0; l <= layer_top - layer_bottom; l++) {
+
+				Rect& bb = bbs[layer_bottom + l];
+
+				_mm256_storeu_pd(ll_x4_.data(), ll_x4[l]);
+				_mm256_storeu_pd(ll_y4_.data(), ll_y4[l]);
+				_mm256_storeu_pd(ur_x4_.data(), ur_x4[l]);
+				_mm256_storeu_pd(ur_y4_.data(), ur_y4[l]);
+				for (i = 0; i < 4; i++) {
+					bb.ll.x = min(bb.ll.x, ll_x4_[i]);
+					bb.ll.y = min(bb.ll.y, ll_y4_[i]);
+					bb.ur.x = max(bb.ur.x, ur_x4_[i]);
+					bb.ur.y = max(bb.ur.y, ur_y4_[i]);
+				}
+			}
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(count4_.data()), count4);
+			blocks_layer_top = count4_[0] + count4_[1] + count4_[2] + count4_[3];
+
+			// scalar fallback, also handles remaining blocks
+			for (; b < end; b++) {
+
+				Rect& bb = bbs[layer[b]];
+				bb.ll.x = min(bb.ll.x, ll_x[b]);
+				bb.ll.y = min(bb.ll.y, ll_y[b]);
+				bb.ur.x = max(bb.ur.x, ur_x[b]);
+				bb.ur.y = max(bb.ur.y, ur_y[b]);
+
+				if (layer[b] == layer_top) {
+					blocks_layer_top++;
+				}
+			}
+		};
+#endif
+};
+
+#endif
@@ -0,0 +1,154 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar contour over fixed coordinates, e.g., for packing
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_COMPRESSED_CONTOUR
+#define _CORBLIVAR_COMPRESSED_CONTOUR
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+// Contour of blocks, i.e., their right (upper) front as step function of the
+// y-coordinate (x-coordinate), where all boundaries of the blocks' ranges are known in
+// advance; as for packing, where blocks are only moved in the other dimension. The
+// boundaries are compressed into elementary segments, which are covered by a segment
+// tree; updating and querying the front of some range is thus performed in logarithmic
+// time, and w/o allocations once the buffers reached their final capacity
+class CompressedContour {
+	// private data, functions
+	private:
+		// sorted, unique boundaries; boundaries[i] and boundaries[i + 1] limit
+		// the elementary segment i
+		vector<double> boundaries;
+
+		// segment tree, w/ the root as node 1 and the elementary segments as
+		// leaves, starting at node leaves; for each node, the max front of all
+		// blocks covering (parts of) the node's segments, and the max front of
+		// all blocks covering all the node's segments
+		unsigned leaves;
+		vector<double> fronts, covering_fronts;
+
+	// constructors, destructors, if any non-implicit
+	public:
+		CompressedContour() {
+			this->leaves = 1;
+		};
+
+	// public data, functions
+	public:
+		// reset handler; all boundaries of ranges to be considered have to be
+		// added subsequently, followed by init()
+		inline void reset() {
+			this->boundaries.clear();
+		};
+		inline void addBoundary(double const& boundary) {
+			this->boundaries.push_back(boundary);
+		};
+		// init w/ zero front for all segments
+		inline void init() {
+
+			sort(this->boundaries.begin(), this->boundaries.end());
+			this->boundaries.erase(unique(this->boundaries.begin(), this->boundaries.end()), this->boundaries.end());
+
+			this->leaves = 1;
+			while (this->leaves < this->boundaries.size()) {
+				this->leaves *= 2;
+			}
+
+			// note that assigning retains capacities
+			this->fronts.assign(2 * this->leaves, 0.0);
+			this->covering_fronts.assign(2 * this->leaves, 0.0);
+		};
+
+		// index of segment starting w/ the given boundary
+		inline unsigned segment(double const& boundary) const {
+			return lower_bound(this->boundaries.begin(), this->boundaries.end(), boundary) - this->boundaries.begin();
+		};
+
+		// consider block covering segments [lower, upper) w/ given front
+		inline void update(unsigned lower, unsigned upper, double const& front) {
+			unsigned node;
+
+			if (upper <= lower) {
+				return;
+			}
+
+			// ancestors of both boundary segments cover (parts of) the range
+			for (node = (this->leaves + lower) / 2; node > 0; node /= 2) {
+				this->fronts[node] = max(this->fronts[node], front);
+			}
+			for (node = (this->leaves + upper - 1) / 2; node > 0; node /= 2) {
+				this->fronts[node] = max(this->fronts[node], front);
+			}
+
+			// nodes covering the range
+			for (lower += this->leaves, upper += this->leaves; lower < upper; lower /= 2, upper /= 2) {
+
+				if (lower % 2 == 1) {
+					this->fronts[lower] = max(this->fronts[lower], front);
+					this->covering_fronts[lower] = max(this->covering_fronts[lower], front);
+					lower++;
+				}
+				if (upper % 2 == 1) {
+					upper--;
+					this->fronts[upper] = max(this->fronts[upper], front);
+					this->covering_fronts[upper] = max(this->covering_fronts[upper], front);
+				}
+			}
+		};
+
+		// max front of all blocks intersecting segments [lower, upper)
+		inline double maxFront(unsigned lower, unsigned upper) const {
+			unsigned node;
+			double ret = 0.0;
+
+			if (upper <= lower) {
+				return ret;
+			}
+
+			// blocks covering ancestors of both boundary segments are relevant
+			for (node = (this->leaves + lower) / 2; node > 0; node /= 2) {
+				ret = max(ret, this->covering_fronts[node]);
+			}
+			for (node = (this->leaves + upper - 1) / 2; node > 0; node /= 2) {
+				ret = max(ret, this->covering_fronts[node]);
+			}
+
+			// nodes covering the range
+			for (lower += this->leaves, upper += this->leaves; lower < upper; lower /= 2, upper /= 2) {
+
+				if (lower % 2 == 1) {
+					ret = max(ret, this->fronts[lower]);
+					lower++;
+				}
+				if (upper % 2 == 1) {
+					upper--;
+					ret = max(ret, this->fronts[upper]);
+				}
+			}
+
+			return ret;
+		};
+};
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar contour, i.e., front of placed blocks
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_CONTOUR
+#define _CORBLIVAR_CONTOUR
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+// Contour of placed blocks, i.e., the right (upper) front of all blocks as step
+// function of the y-coordinate (x-coordinate). Provides the max front of all blocks
+// intersecting some range in logarithmic time (plus the count of steps w/in the
+// range); blocks may be placed in arbitrary order, i.e., also behind the current
+// front. The steps are held in sorted, preallocated buffers; each block adds at most
+// two steps, thus updates are w/o allocations once the buffers are reserved for all
+// blocks
+class Contour {
+	// private data, functions
+	private:
+		// lower boundaries of segments, each extending up to the next boundary,
+		// and the segments' fronts, i.e., the max upper coordinate of all blocks
+		// covering the segment
+		vector<double> lowers;
+		vector<double> fronts;
+
+		// helper to split segment containing the coordinate; returns the index
+		// of the segment starting at the coordinate
+		inline unsigned split(double const& coord) {
+			unsigned s;
+
+			// segment containing the coordinate; always exists due to the
+			// lowermost segment
+			s = upper_bound(this->lowers.begin(), this->lowers.end(), coord) - this->lowers.begin() - 1;
+
+			if (this->lowers[s] == coord) {
+				return s;
+			}
+			else {
+				this->lowers.insert(this->lowers.begin() + s + 1, coord);
+				this->fronts.insert(this->fronts.begin() + s + 1, this->fronts[s]);
+
+				return s + 1;
+			}
+		};
+
+	// constructors, destructors, if any non-implicit
+	public:
+		Contour() {
+			this->reset();
+		};
+
+	// public data, functions
+	public:
+		// reset handler; the buffers are reserved for the given count of blocks
+		inline void reset(unsigned const& blocks = 0) {
+
+			// note that clearing retains capacities
+			this->lowers.clear();
+			this->fronts.clear();
+			this->lowers.reserve(2 * blocks + 1);
+			this->fronts.reserve(2 * blocks + 1);
+
+			// lowermost segment, covering the whole range w/ a zero front
+			this->lowers.push_back(numeric_limits<double>::lowest());
+			this->fronts.push_back(0.0);
+		};
+
+		// consider block covering range [lower, upper) w/ given front
+		inline void update(double const& lower, double const& upper, double const& front) {
+			unsigned s, s_lower, s_upper, s_merged;
+
+			if (upper <= lower) {
+				return;
+			}
+
+			// split segments at range boundaries
+			s_lower = this->split(lower);
+			s_upper = this->split(upper);
+
+			// raise front of covered segments
+			for (s = s_lower; s < s_upper; s++) {
+				this->fronts[s] = max(this->fronts[s], front);
+			}
+
+			// merge segments w/ equal fronts around and w/in the range; keeps
+			// the contour compact. Merged segments are dropped by moving the
+			// remaining ones, up to the segment starting at the upper boundary
+			s = (s_lower > 0) ? (s_lower - 1) : 0;
+			s_merged = s;
+			for (s++; s < this->lowers.size() && this->lowers[s] <= upper; s++) {
+
+				if (this->fronts[s] != this->fronts[s_merged]) {
+					s_merged++;
+					this->lowers[s_merged] = this->lowers[s];
+					this->fronts[s_merged] = this->fronts[s];
+				}
+			}
+			this->lowers.erase(this->lowers.begin() + s_merged + 1, this->lowers.begin() + s);
+			this->fronts.erase(this->fronts.begin() + s_merged + 1, this->fronts.begin() + s);
+		};
+
+		// max front of all blocks intersecting range [lower, upper)
+		inline double maxFront(double const& lower, double const& upper) const {
+			unsigned s;
+			double ret;
+
+			// segment containing the lower boundary
+			s = upper_bound(this->lowers.begin(), this->lowers.end(), lower) - this->lowers.begin() - 1;
+
+			ret = 0.0;
+			for (; s < this->lowers.size() && this->lowers[s] < upper; s++) {
+				ret = max(ret, this->fronts[s]);
+			}
+
+			return ret;
+		};
+};
+
+#endif
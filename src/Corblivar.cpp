@@ -46,6 +46,12 @@ int main (int argc, char** argv) {
 
 	// parse alignment request
 	IO::parseAlignmentRequests(fp, corb.editAlignments());
+	// init related adjacency of blocks and alignment requests
+	corb.initAlignmentReqsAdjacency(fp.getBlocks().size());
+	// init thread pool for concurrent handling of dies
+	corb.initThreadPool();
+	// init thread pool for concurrent evaluation of nets
+	fp.initThreadPool();
 
 	// init thermal analyzer, only reasonable after parsing config file
 	fp.initThermalAnalyzer();
@@ -71,16 +77,28 @@ int main (int argc, char** argv) {
 	}
 	// regular run; perform floorplanning
 	else {
-		// generate new, random data set
-		corb.initCorblivarRandomly(fp.logMed(), fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
-
 		if (fp.logMin()) {
 			cout << "Corblivar> ";
 			cout << "Performing SA floorplanning optimization ..." << endl << endl;
 		}
 
+		// perform replica-exchange SA, i.e., parallel tempering; each replica
+		// is initialized separately
+		if (fp.getSAReplicas() > 1) {
+			done = fp.performSATempering(corb);
+		}
+		// perform SA; multiple concurrent chains, each chain is initialized
+		// separately
+		else if (fp.getSAChains() > 1) {
+			done = fp.performSAChains(corb);
+		}
 		// perform SA; main handler
-		done = fp.performSA(corb);
+		else {
+			// generate new, random data set
+			corb.initCorblivarRandomly(fp.logMed(), fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+
+			done = fp.performSA(corb);
+		}
 
 		if (fp.logMin()) {
 			cout << "Corblivar> ";
@@ -34,6 +34,12 @@
 #include <list>
 #include <utility>
 #include <algorithm>
+#include <limits>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 // (TODO) replace w/ chrono
 #include <sys/timeb.h>
 
@@ -43,6 +49,13 @@
 #include <ctime>
 #include <cstdlib>
 
+// SIMD intrinsics; only available if supported by the target architecture, e.g.,
+// w/ -march=native; for x86 targets, also included for code compiled explicitly for
+// particular instruction sets, see ThermalAnalyzer::kernels() and BoundingBoxKernel
+#if defined(__AVX2__) || defined(__AVX512F__) || defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
 // catches all std libraries; however, also pollutest global namespace
 // http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml#Namespaces
 using namespace std;
@@ -79,7 +79,7 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, ve
 	for (Block& cur_block_copy : blocks_copy) {
 
 		// determine related block from original blocks container
-		cur_block = Block::findBlock(cur_block_copy.id, blocks);
+		cur_block = Block::findBlock(cur_block_copy.numerical_id, blocks);
 
 		// for power-aware assignment, fill layers w/ (sorted) blocks until the
 		// dies are evenly occupied
@@ -118,6 +118,10 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, ve
 		this->dies[die].CBL.S.push_back(move(cur_block));
 		this->dies[die].CBL.L.push_back(move(cur_dir));
 		this->dies[die].CBL.T.push_back(move(cur_t));
+
+		// memorize tuple of block, update journal
+		this->block_tuples[cur_block->numerical_id] = this->dies[die].CBL.size() - 1;
+		this->dies[die].markTuplesModified(this->dies[die].CBL.size() - 1);
 	}
 
 	if (CorblivarCore::DBG) {
@@ -136,11 +140,12 @@ void CorblivarCore::initCorblivarRandomly(bool const& log, int const& layers, ve
 	}
 }
 
-bool CorblivarCore::generateLayout(bool const& perform_alignment) {
+bool CorblivarCore::generateLayout(bool const& perform_alignment, bool const& lazy) {
 	Block const* cur_block;
 	Block const* other_block;
-	list<CorblivarAlignmentReq const*> cur_block_alignment_reqs;
+	vector<CorblivarAlignmentReq const*>& cur_block_alignment_reqs = this->cur_block_alignment_reqs;
 	CorblivarAlignmentReq const* req_processed;
+	unsigned dies_to_place = 0;
 
 	if (CorblivarCore::DBG) {
 		cout << "DBG_CORE> ";
@@ -152,7 +157,49 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 
 	// reset die data, i.e., layout generation handler data
 	for (CorblivarDie& die : this->dies) {
-		die.reset();
+
+		// w/o alignment, dies are handled independently; the layout of dies
+		// w/o modified tuples can thus be retained for lazy layout generation,
+		// and the layout of other dies is regenerated starting from the
+		// nearest checkpoint preceding their first modified tuple
+		if (lazy && !perform_alignment) {
+
+			if (die.outdated_from == numeric_limits<unsigned>::max()) {
+
+				die.done = true;
+				die.regenerated = false;
+
+				continue;
+			}
+
+			die.resume();
+		}
+		else {
+			die.reset();
+		}
+
+		die.outdated_from = numeric_limits<unsigned>::max();
+		die.regenerated = true;
+		die.regenerated_from = die.pi;
+
+		// empty dies, or dies w/o any tuple to be placed after resuming, are
+		// done right away; note that switching dies (see below) relies on this
+		if (die.pi >= die.CBL.size()) {
+			die.done = true;
+		}
+		else {
+			dies_to_place++;
+		}
+	}
+
+	// w/o alignment, dies are handled independently, i.e., blocks are placed
+	// w/in each die separately and concurrently if possible; all dies are done
+	// afterwards, thus the loop below is ended right away
+	if (!perform_alignment) {
+
+		this->handleDies(dies_to_place, [this](unsigned const& d) {
+			this->dies[d].placeRemainingBlocks();
+		});
 	}
 
 	// reset alignments-in-process list
@@ -212,7 +259,7 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 			if (perform_alignment) {
 
 				// determine related requests for current block
-				cur_block_alignment_reqs = this->findAlignmentReqs(cur_block);
+				this->findAlignmentReqs(cur_block, cur_block_alignment_reqs);
 
 				// some requests are given, handle them stepwise
 				if (!cur_block_alignment_reqs.empty()) {
@@ -226,7 +273,7 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 						}
 
 						// determine other block of request
-						if (cur_req->s_i->id == cur_block->id) {
+						if (cur_req->s_i->numerical_id == cur_block->numerical_id) {
 							other_block = cur_req->s_j;
 						}
 						else {
@@ -322,6 +369,17 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 		}
 	}
 
+	// w/ alignment, coordinates are also redetermined for the current block of
+	// a die while handling requests of other blocks, even if that block was
+	// already placed; the outlines maintained during placement are thus not
+	// reliable and have to be redetermined
+	if (perform_alignment) {
+
+		for (CorblivarDie& die : this->dies) {
+			die.determOutline();
+		}
+	}
+
 	if (CorblivarCore::DBG) {
 		cout << "DBG_CORE> ";
 		cout << "Done" << endl;
@@ -330,12 +388,49 @@ bool CorblivarCore::generateLayout(bool const& perform_alignment) {
 	return true;
 }
 
+void CorblivarCore::performPacking(int const& iterations) {
+	unsigned dies_to_pack = 0;
+
+	// sanity check for empty dies; also skip dies w/ retained layout, which is
+	// already packed
+	for (CorblivarDie const& die : this->dies) {
+		if (!die.CBL.empty() && die.regenerated) {
+			dies_to_pack++;
+		}
+	}
+
+	if (iterations <= 0 || dies_to_pack == 0) {
+		return;
+	}
+
+	// perform packing on each die for each dimension separately and subsequently;
+	// multiple iterations may provide denser packing configurations; dies are
+	// handled independently and concurrently if possible
+	this->handleDies(dies_to_pack, [this, &iterations](unsigned const& d) {
+
+		CorblivarDie& die = this->dies[d];
+
+		if (die.CBL.empty() || !die.regenerated) {
+			return;
+		}
+
+		// packing may shift any block of the die
+		die.regenerated_from = 0;
+
+		for (int i = 1; i <= iterations; i++) {
+			die.performPacking(Direction::HORIZONTAL);
+			die.performPacking(Direction::VERTICAL);
+		}
+	});
+}
+
 bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 	Block const* b1;
 	Block const* b2;
 	CorblivarDie* die_b1;
 	CorblivarDie* die_b2;
-	list<Block const*> b1_relev_blocks, b2_relev_blocks;
+	vector<Block const*>& b1_relev_blocks = this->relev_blocks_b1;
+	vector<Block const*>& b2_relev_blocks = this->relev_blocks_b2;
 	Direction dir_b1, dir_b2;
 	bool b1_shifted, b2_shifted;
 	bool b1_to_shift_horizontal, b1_to_shift_vertical, b2_to_shift_horizontal, b2_to_shift_vertical;
@@ -356,8 +451,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		die_b2 = &this->dies[b2->layer];
 
 		// pop relevant blocks from related placement stacks
-		b1_relev_blocks = die_b1->popRelevantBlocks();
-		b2_relev_blocks = die_b2->popRelevantBlocks();
+		die_b1->popRelevantBlocks(b1_relev_blocks);
+		die_b2->popRelevantBlocks(b2_relev_blocks);
 
 		// first, we need to determine which insertion direction is to be applied
 		// for each block
@@ -528,8 +623,8 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		}
 
 		// mark (shifted) blocks as placed
-		b1->placed = true;
-		b2->placed = true;
+		die_b1->markAsPlaced(b1);
+		die_b2->markAsPlaced(b2);
 
 		// placement stacks debugging
 		if (CorblivarDie::DBG_STACKS) {
@@ -570,7 +665,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		// sanity check for diff b/w current CBL tuple and current block; that's
 		// happening when the block to be shifted is not the current block, i.e.,
 		// a block to be processed later on; thus, we skip the alignment for now
-		if (b1->id != die_b1->getCurrentBlock()->id) {
+		if (b1->numerical_id != die_b1->getCurrentBlock()->numerical_id) {
 
 			if (CorblivarCore::DBG_ALIGNMENT_REQ) {
 				cout << "DBG_ALIGNMENT>     Shift block is not current block; abort alignment" << endl;
@@ -580,7 +675,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		}
 
 		// pop relevant blocks from related placement stack
-		b1_relev_blocks = die_b1->popRelevantBlocks();
+		die_b1->popRelevantBlocks(b1_relev_blocks);
 
 		// horizontal placement
 		if (die_b1->getCurrentDirection() == Direction::HORIZONTAL) {
@@ -638,7 +733,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 		}
 
 		// mark shifted block as placed
-		b1->placed = true;
+		die_b1->markAsPlaced(b1);
 
 		// placement stacks debugging
 		if (CorblivarDie::DBG_STACKS) {
@@ -649,7 +744,7 @@ bool CorblivarCore::alignBlocks(CorblivarAlignmentReq const* req) {
 	return true;
 }
 
-void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie* die_b2, CorblivarAlignmentReq const* req, list<Block const*> b1_relev_blocks, list<Block const*> b2_relev_blocks, Direction const& dir_b1, bool& b1_shifted, bool& b2_shifted) {
+void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie* die_b2, CorblivarAlignmentReq const* req, vector<Block const*> const& b1_relev_blocks, vector<Block const*> const& b2_relev_blocks, Direction const& dir_b1, bool& b1_shifted, bool& b2_shifted) {
 
 	// annotate that b1 is shifted at least in one direction
 	b1_shifted = true;
@@ -737,43 +832,70 @@ void CorblivarCore::sequentialShiftingHelper(CorblivarDie* die_b1, CorblivarDie*
 	}
 }
 
-list<CorblivarAlignmentReq const*> CorblivarCore::findAlignmentReqs(Block const* b) const {
-	list<CorblivarAlignmentReq const*> ret;
+void CorblivarCore::initAlignmentReqsAdjacency(unsigned const& blocks) {
+	unsigned max_degree;
+
+	this->A_adjacency.clear();
+	this->A_adjacency.resize(blocks);
+
+	// memorize each request for both its blocks; note that the dummy reference
+	// block is not considered
+	for (unsigned r = 0; r < this->A.size(); r++) {
+
+		if (this->A[r].s_i->numerical_id != Block::NUMERICAL_ID_RBOD) {
+			this->A_adjacency[this->A[r].s_i->numerical_id].push_back(r);
+		}
+		// requests w/ same block twice are memorized only once
+		if (this->A[r].s_j->numerical_id != Block::NUMERICAL_ID_RBOD && this->A[r].s_j->numerical_id != this->A[r].s_i->numerical_id) {
+			this->A_adjacency[this->A[r].s_j->numerical_id].push_back(r);
+		}
+	}
+
+	// reserve mem for buffer of requests, w/ max count of requests of any block
+	max_degree = 0;
+	for (vector<int> const& reqs : this->A_adjacency) {
+		max_degree = max(max_degree, static_cast<unsigned>(reqs.size()));
+	}
+	this->cur_block_alignment_reqs.reserve(max_degree);
+}
+
+void CorblivarCore::findAlignmentReqs(Block const* b, vector<CorblivarAlignmentReq const*>& reqs) const {
+
+	reqs.clear();
 
 	// sanity check for no given requests
 	if (this->A.empty()) {
-		return ret;
+		return;
 	}
 
-	// determine requests covering the given block
-	for (CorblivarAlignmentReq const& req : this->A) {
+	// requests w/ placed blocks are considered first; eases handling
+	// of alignment requests such that blocks ready for alignment are
+	// placed/aligned first; thus, walk the requests covering the given block
+	// twice, first for requests w/ placed blocks, then for the remaining ones
+	for (int pass = 0; pass < 2; pass++) {
 
-		if (req.s_i->id == b->id || req.s_j->id == b->id) {
+		for (int r : this->A_adjacency[b->numerical_id]) {
+
+			CorblivarAlignmentReq const& req = this->A[r];
 
 			// only consider request which are still in
 			// process, i.e., not both blocks are placed yet
-			if (!req.s_i->placed || !req.s_j->placed) {
+			if (req.s_i->placed && req.s_j->placed) {
+				continue;
+			}
 
-				if (CorblivarCore::DBG_ALIGNMENT_REQ) {
-					cout << "DBG_ALIGNMENT>  Unhandled request: " << req.tupleString() << endl;
-				}
+			// consider request only in related pass
+			if ((req.s_i->placed || req.s_j->placed) != (pass == 0)) {
+				continue;
+			}
 
-				ret.push_back(&req);
+			if (CorblivarCore::DBG_ALIGNMENT_REQ) {
+				cout << "DBG_ALIGNMENT>  Unhandled request: " << req.tupleString() << endl;
 			}
-		}
-	}
 
-	// requests w/ placed blocks are considered first; eases handling
-	// of alignment requests such that blocks ready for alignment are
-	// placed/aligned first
-	ret.sort(
-		// lambda expression
-		[&](CorblivarAlignmentReq const* req1, CorblivarAlignmentReq const* req2) {
-			return (req1->s_i->placed || req1->s_j->placed) && (!req2->s_i->placed && !req2->s_j->placed);
+			reqs.push_back(&req);
 		}
-	);
-
-	return ret;
+	}
 }
 
 void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
@@ -839,6 +961,9 @@ void CorblivarCore::sortCBLs(bool const& log, int const& mode) {
 			die.CBL.T[t] = move(tuples[d][t].T);
 		}
 
+		this->updateBlockTuples(die);
+		die.markTuplesModified();
+
 		d++;
 	}
 
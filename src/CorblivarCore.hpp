@@ -28,6 +28,7 @@
 // Corblivar includes, if any
 #include "CorblivarDie.hpp"
 #include "CorblivarAlignmentReq.hpp"
+#include "ThreadPool.hpp"
 // forward declarations, if any
 class Block;
 
@@ -35,6 +36,7 @@ class CorblivarCore {
 	// debugging code switch (private)
 	private:
 		static constexpr bool DBG = false;
+		static constexpr bool DBG_JOURNAL = false;
 
 	// debugging code switch (public)
 	public:
@@ -50,6 +52,159 @@ class CorblivarCore {
 		// current-die pointer
 		CorblivarDie* p;
 
+		// thread pool for concurrent handling of dies; only available if
+		// initialized, see initThreadPool(), and shared w/ copies of the core
+		shared_ptr<ThreadPool> thread_pool;
+
+		// handler for independent tasks for each die; performed concurrently if
+		// a thread pool is available and multiple dies are relevant
+		inline void handleDies(unsigned const& relevant_dies, function<void(unsigned const&)> const& task) {
+
+			if (this->thread_pool != nullptr && relevant_dies > 1) {
+				this->thread_pool->run(this->dies.size(), task);
+			}
+			else {
+				for (unsigned d = 0; d < this->dies.size(); d++) {
+					task(d);
+				}
+			}
+		};
+
+		// map of blocks to tuples, i.e., for each block (referred to by its
+		// numerical id) the index of its tuple w/in the CBL of its die; the die
+		// itself is given by the block's layer
+		vector<int> block_tuples;
+
+		// update map of blocks to tuples, for tuples starting from given index
+		inline void updateBlockTuples(CorblivarDie const& die, unsigned const& tuple = 0) {
+
+			for (unsigned t = tuple; t < die.CBL.size(); t++) {
+				this->block_tuples[die.CBL.S[t]->numerical_id] = t;
+			}
+		};
+
+		// CBL backup helpers; only the tuples modified since the last update of
+		// the backup are considered, as memorized in the related journal. Note
+		// that the blocks' bb are backed up along w/ their tuples; since blocks
+		// are only reshaped via tuple-related operations, see
+		// markTupleModified(), the shapes of blocks in unmodified tuples match
+		// their backup. The blocks' coordinates are not restored consistently
+		// this way; the layout has to be regenerated after restoring a backup
+		inline void storeCBL(CorblivarDie& die, CornerBlockList& backup, CorblivarDie::Journal& journal, bool const& best) {
+			unsigned size = die.CBL.size();
+
+			backup.S.resize(size);
+			backup.L.resize(size);
+			backup.T.resize(size);
+
+			for (unsigned const& t : journal.tuples) {
+				if (t < size) {
+					this->storeTuple(die.CBL, backup, t, best);
+				}
+			}
+			for (unsigned t = journal.modified_from; t < size; t++) {
+				this->storeTuple(die.CBL, backup, t, best);
+			}
+
+			journal.reset();
+
+			if (CorblivarCore::DBG_JOURNAL) {
+				this->debugJournal(die, backup, best);
+			}
+		};
+		inline void restoreCBL(CorblivarDie& die, CornerBlockList const& backup, CorblivarDie::Journal& journal, CorblivarDie::Journal& other_journal, bool const& best) {
+			unsigned size = backup.size();
+
+			// CBL sizes may differ in case tuples were moved across dies;
+			// related tuples are covered by journal.modified_from
+			if (size != die.CBL.size()) {
+				other_journal.markTuples(min(size, die.CBL.size()));
+				die.outdated_from = min(die.outdated_from, min(size, die.CBL.size()));
+			}
+
+			die.CBL.S.resize(size);
+			die.CBL.L.resize(size);
+			die.CBL.T.resize(size);
+
+			for (unsigned const& t : journal.tuples) {
+				if (t < size) {
+					this->restoreTuple(die, backup, t, best);
+					other_journal.markTuple(t);
+				}
+			}
+			if (journal.modified_from < size) {
+				for (unsigned t = journal.modified_from; t < size; t++) {
+					this->restoreTuple(die, backup, t, best);
+				}
+				other_journal.markTuples(journal.modified_from);
+			}
+
+			journal.reset();
+
+			if (CorblivarCore::DBG_JOURNAL) {
+				this->debugJournal(die, backup, best);
+			}
+		};
+		// journal debugging; CBL and backup, as well as the blocks' shapes, have
+		// to match after storing or restoring the backup
+		inline void debugJournal(CorblivarDie const& die, CornerBlockList const& backup, bool const& best) const {
+
+			if (die.CBL.size() != backup.size()) {
+				cout << "DBG_JOURNAL> CBL and backup differ in size for die " << die.id + 1 << endl;
+				return;
+			}
+
+			for (unsigned t = 0; t < die.CBL.size(); t++) {
+
+				Rect const& bb_backup = best ? die.CBL.S[t]->bb_best : die.CBL.S[t]->bb_backup;
+
+				if (die.CBL.S[t] != backup.S[t] || die.CBL.L[t] != backup.L[t] || die.CBL.T[t] != backup.T[t]) {
+					cout << "DBG_JOURNAL> CBL and backup differ for die " << die.id + 1 << ", tuple " << t << endl;
+				}
+				if (die.CBL.S[t]->bb.w != bb_backup.w || die.CBL.S[t]->bb.h != bb_backup.h) {
+					cout << "DBG_JOURNAL> Shape and backup shape differ for block " << die.CBL.S[t]->id << endl;
+				}
+				if (die.CBL.S[t]->layer != die.id || this->block_tuples[die.CBL.S[t]->numerical_id] != static_cast<int>(t)) {
+					cout << "DBG_JOURNAL> Layer or tuple mismatch for block " << die.CBL.S[t]->id << endl;
+				}
+			}
+		};
+		inline void storeTuple(CornerBlockList const& CBL, CornerBlockList& backup, unsigned const& tuple, bool const& best) const {
+
+			backup.S[tuple] = CBL.S[tuple];
+			backup.L[tuple] = CBL.L[tuple];
+			backup.T[tuple] = CBL.T[tuple];
+
+			// backup bb into block itself
+			if (best) {
+				CBL.S[tuple]->bb_best = CBL.S[tuple]->bb;
+			}
+			else {
+				CBL.S[tuple]->bb_backup = CBL.S[tuple]->bb;
+			}
+		};
+		inline void restoreTuple(CorblivarDie& die, CornerBlockList const& backup, unsigned const& tuple, bool const& best) {
+			Block const* b = backup.S[tuple];
+
+			die.CBL.S[tuple] = b;
+			die.CBL.L[tuple] = backup.L[tuple];
+			die.CBL.T[tuple] = backup.T[tuple];
+
+			// restore bb from block itself
+			if (best) {
+				b->bb = b->bb_best;
+			}
+			else {
+				b->bb = b->bb_backup;
+			}
+			// update layer assignment and map of blocks to tuples
+			b->layer = die.id;
+			this->block_tuples[b->numerical_id] = tuple;
+
+			// the die's layout has to be regenerated, starting from this tuple
+			die.outdated_from = min(die.outdated_from, tuple);
+		};
+
 		// die-selection handler
 		inline bool switchDie() {
 
@@ -73,18 +228,26 @@ class CorblivarCore {
 		// sequence A; alignment requests
 		vector<CorblivarAlignmentReq> A;
 
+		// adjacency of blocks and alignment requests, i.e., for each block
+		// (referred to by its numerical id) the indices of related requests in A
+		vector<vector<int>> A_adjacency;
+		// buffer for requests of current block
+		vector<CorblivarAlignmentReq const*> cur_block_alignment_reqs;
+
 		// alignments-in-process list
 		list<CorblivarAlignmentReq const*> AL;
 
 		// handler for block alignment
 		bool alignBlocks(CorblivarAlignmentReq const* req);
+		// buffers for relevant blocks of both blocks to be aligned
+		vector<Block const*> relev_blocks_b1, relev_blocks_b2;
 		static void sequentialShiftingHelper(
 				CorblivarDie* die_b1, CorblivarDie* die_b2,
 				CorblivarAlignmentReq const* req,
-				list<Block const*> b1_relev_blocks, list<Block const*> b2_relev_blocks,
+				vector<Block const*> const& b1_relev_blocks, vector<Block const*> const& b2_relev_blocks,
 				Direction const& dir_b1,
 				bool& b1_shifted, bool& b2_shifted);
-		list<CorblivarAlignmentReq const*> findAlignmentReqs(Block const* b) const;
+		void findAlignmentReqs(Block const* b, vector<CorblivarAlignmentReq const*>& reqs) const;
 
 	// constructors, destructors, if any non-implicit
 	public:
@@ -95,12 +258,19 @@ class CorblivarCore {
 
 			// init dies and their related structures
 			for (int i = 0; i < layers; i++) {
-				CorblivarDie cur_die = CorblivarDie(i);
+				CorblivarDie cur_die = CorblivarDie(i, blocks);
 				// reserve mem for worst case, i.e., all blocks in one particular die
 				cur_die.CBL.reserve(blocks);
 
 				this->dies.push_back(move(cur_die));
 			}
+
+			// reserve mem for buffers of relevant blocks, again for worst case
+			this->relev_blocks_b1.reserve(blocks);
+			this->relev_blocks_b2.reserve(blocks);
+
+			// init map of blocks to tuples; -1 for blocks not assigned yet
+			this->block_tuples.resize(blocks, -1);
 		};
 
 	// public data, functions
@@ -108,7 +278,19 @@ class CorblivarCore {
 
 		// general operations
 		void initCorblivarRandomly(bool const& log, int const& layers, vector<Block> const& blocks, bool const& power_aware_assignment);
-		bool generateLayout(bool const& perform_alignment);
+		bool generateLayout(bool const& perform_alignment, bool const& lazy = false);
+		void performPacking(int const& iterations);
+		void initAlignmentReqsAdjacency(unsigned const& blocks);
+
+		// init thread pool; one thread per die, limited by the available
+		// hardware threads, where the calling thread is considered as well
+		inline void initThreadPool() {
+			unsigned threads = min<unsigned>(this->dies.size(), thread::hardware_concurrency());
+
+			if (threads > 1) {
+				this->thread_pool = make_shared<ThreadPool>(threads - 1);
+			}
+		};
 
 		// getter
 		inline CorblivarDie& editDie(unsigned const& die) {
@@ -123,6 +305,24 @@ class CorblivarCore {
 		inline vector<CorblivarAlignmentReq> const& getAlignments() const {
 			return this->A;
 		};
+		inline int const& getTuple(Block const* block) const {
+			return this->block_tuples[block->numerical_id];
+		};
+
+		// update map of blocks to tuples and journals for all dies; required
+		// after editing CBLs directly, i.e., not via the operations below
+		inline void handleEditedCBLs() {
+
+			for (CorblivarDie& die : this->dies) {
+				this->updateBlockTuples(die);
+				die.markTuplesModified();
+			}
+		};
+		// journal handler; required for any modification of tuples not
+		// performed via the operations below, i.e., reshaping of blocks
+		inline void markTupleModified(int const& die, int const& tuple) {
+			this->dies[die].markTupleModified(tuple);
+		};
 
 		// abstract layout-modification operations
 		//
@@ -137,6 +337,12 @@ class CorblivarCore {
 			// perform swap
 			swap(this->dies[die1].CBL.S[tuple1], this->dies[die2].CBL.S[tuple2]);
 
+			// update map of blocks to tuples, and journals
+			this->block_tuples[this->dies[die1].CBL.S[tuple1]->numerical_id] = tuple1;
+			this->block_tuples[this->dies[die2].CBL.S[tuple2]->numerical_id] = tuple2;
+			this->dies[die1].markTupleModified(tuple1);
+			this->dies[die2].markTupleModified(tuple2);
+
 			if (DBG) {
 				cout << "DBG_CORE> swapBlocks;";
 				cout << " d1=" << die1;
@@ -165,6 +371,12 @@ class CorblivarCore {
 				swap(this->dies[die1].CBL.S[tuple1], this->dies[die2].CBL.S[tuple2]);
 				swap(this->dies[die1].CBL.L[tuple1], this->dies[die2].CBL.L[tuple2]);
 				swap(this->dies[die1].CBL.T[tuple1], this->dies[die2].CBL.T[tuple2]);
+
+				// update map of blocks to tuples, and journals
+				this->block_tuples[this->dies[die1].CBL.S[tuple1]->numerical_id] = tuple1;
+				this->block_tuples[this->dies[die2].CBL.S[tuple2]->numerical_id] = tuple2;
+				this->dies[die1].markTupleModified(tuple1);
+				this->dies[die2].markTupleModified(tuple2);
 			}
 			// move across dies: perform insert and delete
 			else {
@@ -180,6 +392,13 @@ class CorblivarCore {
 				this->dies[die1].CBL.S.erase(this->dies[die1].CBL.S.begin() + tuple1);
 				this->dies[die1].CBL.L.erase(this->dies[die1].CBL.L.begin() + tuple1);
 				this->dies[die1].CBL.T.erase(this->dies[die1].CBL.T.begin() + tuple1);
+
+				// update map of blocks to tuples, and journals; only tuples
+				// succeeding the inserted/erased tuple are shifted
+				this->updateBlockTuples(this->dies[die1], tuple1);
+				this->updateBlockTuples(this->dies[die2], tuple2);
+				this->dies[die1].markTuplesModified(tuple1);
+				this->dies[die2].markTuplesModified(tuple2);
 			}
 		};
 
@@ -190,6 +409,7 @@ class CorblivarCore {
 			else {
 				this->dies[die].CBL.L[tuple] = Direction::VERTICAL;
 			}
+			this->dies[die].markTupleModified(tuple);
 
 			if (DBG) {
 				cout << "DBG_CORE> switchInsertionDirection;";
@@ -202,6 +422,7 @@ class CorblivarCore {
 
 		inline void switchTupleJunctions(int const& die, int const& tuple, int const& juncts) {
 			this->dies[die].CBL.T[tuple] = juncts;
+			this->dies[die].markTupleModified(tuple);
 
 			if (DBG) {
 				cout << "DBG_CORE> switchTupleJunctions;";
@@ -236,47 +457,13 @@ class CorblivarCore {
 		inline void backupCBLs() {
 
 			for (CorblivarDie& die : this->dies) {
-
-				die.CBLbackup.clear();
-				die.CBLbackup.reserve(die.CBL.capacity());
-
-				for (Block const* b : die.CBL.S) {
-
-					// backup bb into block itself
-					b->bb_backup = b->bb;
-
-					die.CBLbackup.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBL.L) {
-					die.CBLbackup.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBL.T) {
-					die.CBLbackup.T.push_back(t_juncts);
-				}
+				this->storeCBL(die, die.CBLbackup, die.journal_backup, false);
 			}
 		};
 		inline void restoreCBLs() {
 
 			for (CorblivarDie& die : this->dies) {
-
-				die.CBL.clear();
-				die.CBL.reserve(die.CBLbackup.capacity());
-
-				for (Block const* b : die.CBLbackup.S) {
-
-					// restore bb from block itself
-					b->bb = b->bb_backup;
-					// update layer assignment
-					b->layer = die.id;
-
-					die.CBL.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBLbackup.L) {
-					die.CBL.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBLbackup.T) {
-					die.CBL.T.push_back(t_juncts);
-				}
+				this->restoreCBL(die, die.CBLbackup, die.journal_backup, die.journal_best, false);
 			}
 		};
 
@@ -284,23 +471,7 @@ class CorblivarCore {
 		inline void storeBestCBLs() {
 
 			for (CorblivarDie& die : this->dies) {
-
-				die.CBLbest.clear();
-				die.CBLbest.reserve(die.CBL.capacity());
-
-				for (Block const* b : die.CBL.S) {
-
-					// backup bb into block itself
-					b->bb_best = b->bb;
-
-					die.CBLbest.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBL.L) {
-					die.CBLbest.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBL.T) {
-					die.CBLbest.T.push_back(t_juncts);
-				}
+				this->storeCBL(die, die.CBLbest, die.journal_best, true);
 			}
 		};
 		// returns false only if all dies from CBLbest are empty, i.e., no best
@@ -311,29 +482,11 @@ class CorblivarCore {
 
 			for (CorblivarDie& die : this->dies) {
 
-				die.CBL.clear();
-				die.CBL.reserve(die.CBLbest.capacity());
-
 				if (die.CBLbest.empty()) {
 					empty_dies++;
-					continue;
 				}
 
-				for (Block const* b : die.CBLbest.S) {
-
-					// restore bb from block itself
-					b->bb = b->bb_best;
-					// update layer assignment
-					b->layer = die.id;
-
-					die.CBL.S.push_back(b);
-				}
-				for (Direction const& dir : die.CBLbest.L) {
-					die.CBL.L.push_back(dir);
-				}
-				for (unsigned const& t_juncts : die.CBLbest.T) {
-					die.CBL.T.push_back(t_juncts);
-				}
+				this->restoreCBL(die, die.CBLbest, die.journal_best, die.journal_backup, true);
 			}
 
 			ret = (empty_dies != this->dies.size());
@@ -29,7 +29,6 @@
 #include "CorblivarCore.hpp"
 
 void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
-	list<Block const*> relevBlocks;
 
 	// current tuple; only mutable block parameters can be edited
 	Block const* cur_block = this->getCurrentBlock();
@@ -40,35 +39,45 @@ void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
 		return;
 	}
 
+	// memorize checkpoint for resuming layout generation; only w/o alignment
+	if (!alignment_enabled) {
+		this->recordCheckpoint();
+	}
+
 	// pop relevant blocks from related placement stack
-	relevBlocks = this->popRelevantBlocks();
+	this->popRelevantBlocks(this->relev_blocks);
 
 	// horizontal placement
 	if (this->getCurrentDirection() == Direction::HORIZONTAL) {
 
 		// first, determine block's y-coordinates
-		this->determCurrentBlockCoords(Coordinate::Y, relevBlocks);
+		this->determCurrentBlockCoords(Coordinate::Y, this->relev_blocks);
 		// second, determine block's x-coordinates (depends on y-coord; extended
 		// check depends on whether alignment is enabled, i.e., whether some
 		// blocks might be shifted)
-		this->determCurrentBlockCoords(Coordinate::X, relevBlocks, alignment_enabled);
+		this->determCurrentBlockCoords(Coordinate::X, this->relev_blocks, alignment_enabled);
 	}
 	// vertical placement
 	else {
 
 		// first, determine block's x-coordinates
-		this->determCurrentBlockCoords(Coordinate::X, relevBlocks);
+		this->determCurrentBlockCoords(Coordinate::X, this->relev_blocks);
 		// second, determine block's y-coordinates (depends on x-coord; extended
 		// check depends on whether alignment is enabled, i.e., whether some
 		// blocks might be shifted)
-		this->determCurrentBlockCoords(Coordinate::Y, relevBlocks, alignment_enabled);
+		this->determCurrentBlockCoords(Coordinate::Y, this->relev_blocks, alignment_enabled);
 	}
 
 	// update placement stacks
-	this->updatePlacementStacks(relevBlocks);
+	this->updatePlacementStacks(this->relev_blocks);
 
 	// mark block as placed
-	cur_block->placed = true;
+	this->markAsPlaced(cur_block);
+
+	// memorize bb of placed block, for resuming layout generation
+	if (!alignment_enabled) {
+		this->placed_bbs[this->pi] = cur_block->bb;
+	}
 
 	// placement stacks debugging
 	if (CorblivarDie::DBG_STACKS) {
@@ -78,7 +87,7 @@ void CorblivarDie::placeCurrentBlock(bool const& alignment_enabled) {
 
 void CorblivarDie::debugStacks() {
 	Block const* cur_block = this->getCurrentBlock();
-	list<Block const*>::iterator iter;
+	vector<Block const*>::reverse_iterator iter;
 
 	cout << "DBG_CORB> ";
 	cout << "Processed (placed) CBL tuple " << this->getCBL().tupleString(this->pi) << " on die " << this->id + 1 << ": ";
@@ -86,9 +95,9 @@ void CorblivarDie::debugStacks() {
 	cout << "UR=(" << cur_block->bb.ur.x << ", " << cur_block->bb.ur.y << ")" << endl;
 
 	cout << "DBG_CORB>  new stack Hi: ";
-	for (iter = this->Hi.begin(); iter != this->Hi.end(); ++iter) {
+	for (iter = this->Hi.rbegin(); iter != this->Hi.rend(); ++iter) {
 
-		if (*iter != this->Hi.back()) {
+		if (*iter != this->Hi.front()) {
 			cout << (*iter)->id << ", ";
 		}
 		else {
@@ -98,9 +107,9 @@ void CorblivarDie::debugStacks() {
 	}
 
 	cout << "DBG_CORB>  new stack Vi: ";
-	for (iter = this->Vi.begin(); iter != this->Vi.end(); ++iter) {
+	for (iter = this->Vi.rbegin(); iter != this->Vi.rend(); ++iter) {
 
-		if (*iter != this->Vi.back()) {
+		if (*iter != this->Vi.front()) {
 			cout << (*iter)->id << ", ";
 		}
 		else {
@@ -123,7 +132,7 @@ bool CorblivarDie::debugLayout() const {
 
 			// ignore in outer loop checked blocks; start inner loop
 			// after current block is self-checked
-			if (a->id == b->id) {
+			if (a->numerical_id == b->numerical_id) {
 				flag_inner = true;
 				continue;
 			}
@@ -140,10 +149,11 @@ bool CorblivarDie::debugLayout() const {
 	return invalid;
 }
 
-list<Block const*> CorblivarDie::popRelevantBlocks() {
-	list<Block const*> ret;
+void CorblivarDie::popRelevantBlocks(vector<Block const*>& relev_blocks_stack) {
 	unsigned blocks_count;
 
+	relev_blocks_stack.clear();
+
 	// horizontal placement; consider stack Hi
 	if (this->getCurrentDirection() == Direction::HORIZONTAL) {
 
@@ -152,9 +162,9 @@ list<Block const*> CorblivarDie::popRelevantBlocks() {
 		blocks_count = min<unsigned>(this->getJunctions(this->pi) + 1, this->Hi.size());
 
 		// pop relevant blocks from stack into return list
-		while (blocks_count > ret.size()) {
-			ret.push_back(move(this->Hi.front()));
-			this->Hi.pop_front();
+		while (blocks_count > relev_blocks_stack.size()) {
+			relev_blocks_stack.push_back(this->Hi.back());
+			this->Hi.pop_back();
 		}
 	}
 	// vertical placement; consider stack Vi
@@ -165,16 +175,14 @@ list<Block const*> CorblivarDie::popRelevantBlocks() {
 		blocks_count = min<unsigned>(this->getJunctions(this->pi) + 1, this->Vi.size());
 
 		// pop relevant blocks from stack into return list
-		while (blocks_count > ret.size()) {
-			ret.push_back(move(this->Vi.front()));
-			this->Vi.pop_front();
+		while (blocks_count > relev_blocks_stack.size()) {
+			relev_blocks_stack.push_back(this->Vi.back());
+			this->Vi.pop_back();
 		}
 	}
-
-	return ret;
 }
 
-void CorblivarDie::updatePlacementStacks(list<Block const*>& relev_blocks_stack) {
+void CorblivarDie::updatePlacementStacks(vector<Block const*> const& relev_blocks_stack) {
 	bool add_to_stack;
 	Block const* b;
 
@@ -188,7 +196,7 @@ void CorblivarDie::updatePlacementStacks(list<Block const*>& relev_blocks_stack)
 
 		cout << "; relevant blocks: ";
 		for (Block const* b : relev_blocks_stack) {
-			if (b->id != relev_blocks_stack.back()->id) {
+			if (b->numerical_id != relev_blocks_stack.back()->numerical_id) {
 				cout << b->id << ", ";
 			}
 			else {
@@ -217,24 +225,24 @@ void CorblivarDie::updatePlacementStacks(list<Block const*>& relev_blocks_stack)
 		}
 		// actual stack update
 		if (add_to_stack) {
-			this->Vi.push_front(cur_block);
+			this->Vi.push_back(cur_block);
 		}
 
 		// update horizontal stack
 		//
 		// always consider cur_block since it's one of the right-most blocks now
-		this->Hi.push_front(cur_block);
+		this->Hi.push_back(cur_block);
 		//
 		// add relevant blocks which have no block to the right, simplified by
 		// checking against cur_block (only block which can be right of others);
 		// by reverse iteration, we retain the (implicit) ordering of blocks
 		// popped from stack Hi regarding their insertion order; required for
 		// proper stack manipulation
-		for (list<Block const*>::reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
+		for (vector<Block const*>::const_reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
 			b = *r_iter;
 
 			if (!Rect::rectA_leftOf_rectB(b->bb, cur_block->bb, true)) {
-				this->Hi.push_front(b);
+				this->Hi.push_back(b);
 			}
 		}
 	}
@@ -256,32 +264,30 @@ void CorblivarDie::updatePlacementStacks(list<Block const*>& relev_blocks_stack)
 		}
 		// actual stack update
 		if (add_to_stack) {
-			this->Hi.push_front(cur_block);
+			this->Hi.push_back(cur_block);
 		}
 
 		// update vertical stack
 		//
 		// always consider cur_block since it's one of the top-most blocks now
-		this->Vi.push_front(cur_block);
+		this->Vi.push_back(cur_block);
 		//
 		// add relevant blocks which have no block above, simplified by checking
 		// against cur_block (only block which can be above others); by reverse
 		// iteration, we retain the (implicit) ordering of blocks popped from
 		// stack Vi regarding their insertion order; required for proper stack
 		// manipulation
-		for (list<Block const*>::reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
+		for (vector<Block const*>::const_reverse_iterator r_iter = relev_blocks_stack.rbegin(); r_iter != relev_blocks_stack.rend(); ++r_iter) {
 			b = *r_iter;
 
 			if (!Rect::rectA_below_rectB(b->bb, cur_block->bb, true)) {
-				this->Vi.push_front(b);
+				this->Vi.push_back(b);
 			}
 		}
 	}
 }
 
-void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack) {
-	list<Block const*>::iterator iter;
-	list<Block const*> stack_backup;
+void CorblivarDie::rebuildPlacementStacks(vector<Block const*> const& relev_blocks_stack) {
 	bool covered;
 
 	// current block
@@ -294,7 +300,7 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 
 		cout << "; relevant blocks: ";
 		for (Block const* b : relev_blocks_stack) {
-			if (b->id != relev_blocks_stack.back()->id) {
+			if (b->numerical_id != relev_blocks_stack.back()->numerical_id) {
 				cout << b->id << ", ";
 			}
 			else {
@@ -315,14 +321,17 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 
 	// horizontal stack Hi
 	//
-	// a) check remaining blocks if they are covered now (by current block)
-	for (iter = this->Hi.begin(); iter != this->Hi.end(); ++iter) {
-		// block is now covered
-		if (Rect::rectA_leftOf_rectB((*iter)->bb, cur_block->bb, true)) {
-			// drop block from stack
-			iter = this->Hi.erase(iter);
-		}
-	}
+	// a) check remaining blocks if they are covered now (by current block); drop
+	// covered blocks from stack
+	this->Hi.erase(
+		remove_if(this->Hi.begin(), this->Hi.end(),
+			// lambda expression
+			[&](Block const* b) {
+				return Rect::rectA_leftOf_rectB(b->bb, cur_block->bb, true);
+			}
+		),
+		this->Hi.end()
+	);
 
 	// a) push back relevant blocks in case they are not covered (by current block);
 	// only for related insertion direction
@@ -330,7 +339,7 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 
 		for (Block const* b : relev_blocks_stack) {
 			if (!Rect::rectA_leftOf_rectB(b->bb, cur_block->bb, true)) {
-				this->Hi.push_front(b);
+				this->Hi.push_back(b);
 			}
 		}
 	}
@@ -353,29 +362,32 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 		}
 	}
 	if (!covered) {
-		this->Hi.push_back(cur_block);
+		this->Hi.insert(this->Hi.begin(), cur_block);
 	}
 
 	// c) sort stack by y-dimension in descending order; retains the proper stack
 	// structure for further horizontal block insertion
-	this->Hi.sort(
+	CorblivarDie::sortStack(this->Hi,
 		// lambda expression
 		[&](Block const* b1, Block const* b2) {
 			// descending order, b1 above b2
-			return !Rect::rectA_below_rectB(b1->bb, b2->bb, false);
+			return Rect::rectA_below_rectB(b2->bb, b1->bb, false);
 		}
 	);
 
 	// vertical stack Vi
 	//
-	// a) check remaining blocks if they are covered now (by current block)
-	for (iter = this->Vi.begin(); iter != this->Vi.end(); ++iter) {
-		// block is now covered
-		if (Rect::rectA_below_rectB((*iter)->bb, cur_block->bb, true)) {
-			// drop block from stack
-			iter = this->Vi.erase(iter);
-		}
-	}
+	// a) check remaining blocks if they are covered now (by current block); drop
+	// covered blocks from stack
+	this->Vi.erase(
+		remove_if(this->Vi.begin(), this->Vi.end(),
+			// lambda expression
+			[&](Block const* b) {
+				return Rect::rectA_below_rectB(b->bb, cur_block->bb, true);
+			}
+		),
+		this->Vi.end()
+	);
 
 	// a) push back relevant blocks in case they are not covered (by current block);
 	// only for related insertion direction
@@ -383,7 +395,7 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 
 		for (Block const* b : relev_blocks_stack) {
 			if (!Rect::rectA_below_rectB(b->bb, cur_block->bb, true)) {
-				this->Vi.push_front(b);
+				this->Vi.push_back(b);
 			}
 		}
 	}
@@ -406,58 +418,46 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 		}
 	}
 	if (!covered) {
-		this->Vi.push_back(cur_block);
+		this->Vi.insert(this->Vi.begin(), cur_block);
 	}
 
 	// c) sort stack by x-dimension in descending order; retains the proper stack
 	// structure for further vertical block insertion
-	this->Vi.sort(
+	CorblivarDie::sortStack(this->Vi,
 		// lambda expression
 		[&](Block const* b1, Block const* b2) {
 			// descending order, b1 right of b2
-			return !Rect::rectA_leftOf_rectB(b1->bb, b2->bb, false);
+			return Rect::rectA_leftOf_rectB(b2->bb, b1->bb, false);
 		}
 	);
 
 	// sanity check for different corner blocks; may result due to shifting of blocks;
 	// we need to try fixing both stacks since we cannot assume which is the correct
 	// corner block in this case
-	if (this->Hi.front() != this->Vi.front()) {
+	if (!this->Hi.empty() && !this->Vi.empty() && this->Hi.back() != this->Vi.back()) {
 
 		// first, try to fix Hi
 		//
 		// local copy Hi for backup
-		stack_backup = this->Hi;
+		this->stack_backup = this->Hi;
 
 		// try dropping blocks until corner blocks match
-		while (this->Hi.front() != this->Vi.front()) {
-
-			if (this->Hi.empty()) {
-				break;
-			}
-			else {
-				this->Hi.pop_front();
-			}
+		while (!this->Hi.empty() && this->Hi.back() != this->Vi.back()) {
+			this->Hi.pop_back();
 		}
 
 		// fixing this stack failed, retry w/ Vi
 		if (this->Hi.empty()) {
 
 			// restore Hi
-			this->Hi = stack_backup;
+			this->Hi = this->stack_backup;
 
 			// local copy Vi for backup
-			stack_backup = this->Vi;
+			this->stack_backup = this->Vi;
 
 			// try dropping blocks until corner blocks match
-			while (this->Hi.front() != this->Vi.front()) {
-
-				if (this->Vi.empty()) {
-					break;
-				}
-				else {
-					this->Vi.pop_front();
-				}
+			while (!this->Vi.empty() && this->Hi.back() != this->Vi.back()) {
+				this->Vi.pop_back();
 			}
 
 			// 2nd stack fix failed; this will most likely result in invalid
@@ -465,7 +465,7 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 			if (this->Vi.empty()) {
 
 				// restore Vi
-				this->Vi = stack_backup;
+				this->Vi = this->stack_backup;
 
 				// dbg log for failure
 				if (CorblivarDie::DBG_STACKS) {
@@ -476,7 +476,28 @@ void CorblivarDie::rebuildPlacementStacks(list<Block const*>& relev_blocks_stack
 	}
 }
 
-void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, list<Block const*> const& relev_blocks_stack, bool const& extended_check) const {
+// stable insertion sort; stacks are rather small, and in contrast to list::sort and
+// stable_sort, no allocations are required
+template<typename Order>
+void CorblivarDie::sortStack(vector<Block const*>& stack, Order const& top_first) {
+	int i, j;
+	Block const* b;
+
+	// the top of stack is the last element, i.e., the vector is sorted such that
+	// bottom elements are first
+	for (i = 1; i < static_cast<int>(stack.size()); i++) {
+
+		b = stack[i];
+
+		for (j = i - 1; j >= 0 && top_first(stack[j], b); j--) {
+			stack[j + 1] = stack[j];
+		}
+
+		stack[j + 1] = b;
+	}
+}
+
+void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, vector<Block const*> const& relev_blocks_stack, bool const& extended_check) const {
 	double x, y;
 
 	// current block
@@ -524,25 +545,28 @@ void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, list<Block
 			// block are the relevant boundaries; thus, we need to check
 			// against all previously placed blocks
 			//
+			// all placed blocks are captured in the contour; thus, determine
+			// right front of all blocks which intersect in y-direction
 			if (extended_check) {
 
-				// walk all blocks (implicitly ordered such that placed
-				// blocks are first)
-				for (unsigned b = 0; b < this->getCBL().size(); b++) {
+				this->updateContours();
+				x = this->right_front.maxFront(cur_block->bb.ll.y, cur_block->bb.ur.y);
 
-					// if not yet placed block is reached, the
-					// following blocks are also not placed, i.e., not
-					// relevant; break loop
-					if (!this->getBlock(b)->placed) {
-						break;
-					}
-					else {
-						// only consider blocks which intersect in y-direction
+				// sanity check; compare w/ walking all blocks
+				// (implicitly ordered such that placed blocks are
+				// first)
+				if (CorblivarDie::DBG_CONTOURS) {
+					double x_ = 0;
+
+					for (unsigned b = 0; b < this->getCBL().size() && this->getBlock(b)->placed; b++) {
 						if (Rect::rectsIntersectVertical(cur_block->bb, this->getBlock(b)->bb)) {
-							// determine right front
-							x = max(x, this->getBlock(b)->bb.ur.x);
+							x_ = max(x_, this->getBlock(b)->bb.ur.x);
 						}
 					}
+
+					if (x != x_) {
+						cout << "DBG_CONTOURS> Right front differs for block " << cur_block->id << ": " << x << " vs " << x_ << endl;
+					}
 				}
 			}
 			// non shifted block / trivial case w/o alignment; simply check
@@ -562,6 +586,7 @@ void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, list<Block
 		}
 
 		// update block's x-coordinates
+		this->currentBlockModified();
 		cur_block->bb.ll.x = x;
 		cur_block->bb.ur.x = cur_block->bb.w + x;
 	}
@@ -606,25 +631,28 @@ void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, list<Block
 			// block are the relevant boundaries; thus, we need to check
 			// against all previously placed blocks
 			//
+			// all placed blocks are captured in the contour; thus, determine
+			// upper front of all blocks which intersect in x-direction
 			if (extended_check) {
 
-				// walk all blocks (implicitly ordered such that placed
-				// blocks are first)
-				for (unsigned b = 0; b < this->getCBL().size(); b++) {
+				this->updateContours();
+				y = this->upper_front.maxFront(cur_block->bb.ll.x, cur_block->bb.ur.x);
 
-					// if not yet placed block is reached, the
-					// following blocks are also not placed, i.e., not
-					// relevant; break loop
-					if (!this->getBlock(b)->placed) {
-						break;
-					}
-					else {
-						// only consider blocks which intersect in x-direction
+				// sanity check; compare w/ walking all blocks
+				// (implicitly ordered such that placed blocks are
+				// first)
+				if (CorblivarDie::DBG_CONTOURS) {
+					double y_ = 0;
+
+					for (unsigned b = 0; b < this->getCBL().size() && this->getBlock(b)->placed; b++) {
 						if (Rect::rectsIntersectHorizontal(cur_block->bb, this->getBlock(b)->bb)) {
-							// determine upper front
-							y = max(y, this->getBlock(b)->bb.ur.y);
+							y_ = max(y_, this->getBlock(b)->bb.ur.y);
 						}
 					}
+
+					if (y != y_) {
+						cout << "DBG_CONTOURS> Upper front differs for block " << cur_block->id << ": " << y << " vs " << y_ << endl;
+					}
 				}
 			}
 			// non shifted block / trivial case w/o alignment; simply check
@@ -644,6 +672,7 @@ void CorblivarDie::determCurrentBlockCoords(Coordinate const& coord, list<Block
 		}
 
 		// update block's y-coordinates
+		this->currentBlockModified();
 		cur_block->bb.ll.y = y;
 		cur_block->bb.ur.y = cur_block->bb.h + y;
 	}
@@ -665,7 +694,7 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 	shifted = false;
 
 	// first, determine reference block
-	if (shift_block->id == req->s_i->id) {
+	if (shift_block->numerical_id == req->s_i->numerical_id) {
 		reference_block = req->s_j;
 	}
 	else {
@@ -718,7 +747,7 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 			// walk all blocks (implicitly ordered such that placed blocks are first)
 			for (unsigned b = 0; b < this->getCBL().size(); b++) {
 
-				if (this->getBlock(b)->id == shift_block->id) {
+				if (this->getBlock(b)->numerical_id == shift_block->numerical_id) {
 					break;
 				}
 				else {
@@ -762,6 +791,7 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 
 			// apply shifting
 			if (!dry_run) {
+				this->currentBlockModified();
 				shift_block->bb.ll.x += shift_x;
 				shift_block->bb.ur.x += shift_x;
 			}
@@ -826,7 +856,7 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 			// walk all blocks (implicitly ordered such that placed blocks are first)
 			for (unsigned b = 0; b < this->getCBL().size(); b++) {
 
-				if (this->getBlock(b)->id == shift_block->id) {
+				if (this->getBlock(b)->numerical_id == shift_block->numerical_id) {
 					break;
 				}
 				else {
@@ -870,6 +900,7 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 
 			// apply shifting
 			if (!dry_run) {
+				this->currentBlockModified();
 				shift_block->bb.ll.y += shift_y;
 				shift_block->bb.ur.y += shift_y;
 			}
@@ -899,111 +930,70 @@ bool CorblivarDie::shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq
 // (FloorPlanner::determCostAlignment does annotate alignment success / failure to the
 // blocks themselves)
 void CorblivarDie::performPacking(Direction const& dir) {
-	list<Block const*> blocks;
-	list<Block const*>::iterator i1;
-	list<Block const*>::reverse_iterator i2;
-	Block const* block;
-	Block const* neighbor;
+	vector<Block const*>& blocks = this->packing_blocks;
+	CompressedContour& front = this->packing_front;
+	unsigned lower, upper;
 	double x, y;
-	vector<Rect> blocks_checked;
-	double range_checked;
-	Rect cur_intersect, cur_prev_intersect;
 
-	// store blocks in separate list, for subsequent sorting
-	blocks.insert(blocks.begin(), this->getCBL().S.begin(), this->getCBL().S.end());
+	// store blocks in separate buffer, for subsequent sorting
+	blocks.assign(this->getCBL().S.begin(), this->getCBL().S.end());
 
 	if (dir == Direction::HORIZONTAL) {
 
 		// sort blocks by lower-left x-coordinate (ascending order)
-		blocks.sort(
+		sort(blocks.begin(), blocks.end(),
 			// lambda expression
 			[&](Block const* b1, Block const* b2){
 				return (b1->bb.ll.x < b2->bb.ll.x)
 					// for blocks on same column, sort additionally by
-					// their width, putting the bigger back in the
-					// list, thus consider them first during
-					// subsequent checking for adjacent blocks
-					// (reverse list traversal)
+					// their width and by their y-coordinate; not
+					// required for packing itself, but provides a
+					// deterministic order
 					|| ((b1->bb.ll.x == b2->bb.ll.x) && (b1->bb.ur.x < b2->bb.ur.x))
-					// for blocks on same column and w/ same width,
-					// order additionally by y-coordinate to ease list
-					// traversal (relevant blocks are adjacent tuples
-					// in list)
 					|| ((b1->bb.ll.x == b2->bb.ll.x) && (b1->bb.ur.x == b2->bb.ur.x) && (b1->bb.ll.y < b2->bb.ll.y))
 					;
 			}
 		);
 
-		// for each block, check the adjacent blocks and perform packing by
-		// considering the neighbors' nearest right front
-		for (i1 = blocks.begin(); i1 != blocks.end(); ++i1) {
-			block= *i1;
-
-			// skip blocks at left boundary, they are implicitly packed
-			if (block->bb.ll.x == 0.0) {
-				continue;
-			}
-
-			// also skip blocks which are successfully aligned; this way, they
-			// keep their position and alignment is not broken
-			if (block->alignment == Block::AlignmentStatus::SUCCESS) {
-				continue;
-			}
-
-			// init packed coordinate
-			x = 0.0;
-			// init search stop flag
-			blocks_checked.clear();
-			range_checked = 0.0;
-
-			// check against other blocks; walk in reverse order since we only need to
-			// consider the blocks to the left
-			for (i2 = list<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
-				neighbor = *i2;
-
-				if (Rect::rectA_leftOf_rectB(neighbor->bb, block->bb, true)) {
-
-					// determine the packed coordinate by considering
-					// the neigbors nearest right front
-					x = max(x, neighbor->bb.ur.x);
+		// init right front; the blocks' y-coordinates are not modified during
+		// horizontal packing, thus they can be considered in advance
+		front.reset();
+		for (Block const* b : blocks) {
+			front.addBoundary(b->bb.ll.y);
+			front.addBoundary(b->bb.ur.y);
+		}
+		front.init();
 
-					// current blocks' intersection
-					cur_intersect = Rect::determineIntersection(neighbor->bb, block->bb);
+		// the outline's x-coordinate is redetermined by the packed blocks
+		this->outline.x = 0.0;
 
-					// initially, consider the full intersection range
-					// as relevant
-					range_checked += cur_intersect.h;
+		// for each block, determine the right front of all blocks to the left,
+		// i.e., of all previously packed blocks intersecting in y-direction, and
+		// perform packing accordingly
+		for (Block const* block : blocks) {
 
-					// check the intersection w/ previous
-					// intersections in order to avoid redundant
-					// considerations of ranges
-					for (Rect const& r : blocks_checked) {
+			// segments covered by block
+			lower = front.segment(block->bb.ll.y);
+			upper = front.segment(block->bb.ur.y);
 
-						cur_prev_intersect = Rect::determineIntersection(cur_intersect, r);
-						// drop the additionally, redundant
-						// covered range
-						if (cur_prev_intersect.h > 0.0) {
-							range_checked -= cur_prev_intersect.h;
-						}
-					}
+			// skip blocks at left boundary, they are implicitly packed; also
+			// skip blocks which are successfully aligned; this way, they keep
+			// their position and alignment is not broken
+			if (block->bb.ll.x != 0.0 && block->alignment != Block::AlignmentStatus::SUCCESS) {
 
-					// memorize the actually covered range of the
-					// block front; use a set of rectangles
-					blocks_checked.push_back(cur_intersect);
+				// packed coordinate; sanity check for invalid, i.e.,
+				// overlapping, layouts: blocks are never moved to the right
+				x = min(block->bb.ll.x, front.maxFront(lower, upper));
 
-					// in case the full block front was checked, we
-					// can stop checking other blocks
-					if (Math::doubleComp(block->bb.h, range_checked)) {
-						break;
-					}
-				}
+				// update coordinate on block itself
+				block->bb.ll.x = x;
+				block->bb.ur.x = block->bb.w + x;
 			}
 
-			// update coordinate on block itself, effects the final layout as well as
-			// the currently walked list (which is required for step-wise packing from
-			// left to right boundary)
-			block->bb.ll.x = x;
-			block->bb.ur.x = block->bb.w + x;
+			// memorize the block's final coordinates in the front and
+			// outline
+			front.update(lower, upper, block->bb.ur.x);
+			this->outline.x = max(this->outline.x, block->bb.ur.x);
 		}
 	}
 
@@ -1011,95 +1001,59 @@ void CorblivarDie::performPacking(Direction const& dir) {
 	else {
 
 		// sort blocks by lower-left y-coordinate (ascending order)
-		blocks.sort(
+		sort(blocks.begin(), blocks.end(),
 			// lambda expression
 			[&](Block const* b1, Block const* b2){
 				return (b1->bb.ll.y < b2->bb.ll.y)
 					// for blocks on same row, sort additionally by
-					// their height, putting the bigger back in the
-					// list, thus consider them first during
-					// subsequent checking for adjacent blocks
-					// (reverse list traversal)
+					// their height and by their x-coordinate; not
+					// required for packing itself, but provides a
+					// deterministic order
 					|| ((b1->bb.ll.y == b2->bb.ll.y) && (b1->bb.ur.y < b2->bb.ur.y))
-					// for blocks on same row and w/ same height,
-					// order additionally by x-coordinate to ease list
-					// traversal (relevant blocks are adjacent tuples
-					// in list)
 					|| ((b1->bb.ll.y == b2->bb.ll.y) && (b1->bb.ur.y == b2->bb.ur.y) && (b1->bb.ll.x < b2->bb.ll.x))
 					;
 			}
 		);
 
-		// for each block, check the adjacent blocks and perform packing by
-		// considering the neighbors' nearest upper front
-		for (i1 = blocks.begin(); i1 != blocks.end(); ++i1) {
-			block= *i1;
-
-			// skip blocks at bottom boundary, they are implicitly packed
-			if (block->bb.ll.y == 0.0) {
-				continue;
-			}
-
-			// also skip blocks which are successfully aligned; this way, they
-			// keep their position and alignment is not broken
-			if (block->alignment == Block::AlignmentStatus::SUCCESS) {
-				continue;
-			}
-
-			// init packed coordinate
-			y = 0.0;
-			// init search stop flag
-			blocks_checked.clear();
-			range_checked = 0.0;
-
-			// check against other blocks; walk in reverse order since we only need to
-			// consider the blocks below
-			for (i2 = list<Block const*>::reverse_iterator(i1); i2 != blocks.rend(); ++i2) {
-				neighbor = *i2;
-
-				if (Rect::rectA_below_rectB(neighbor->bb, block->bb, true)) {
-
-					// determine the packed coordinate by considering
-					// the neigbors nearest right front
-					y = max(y, neighbor->bb.ur.y);
+		// init upper front; the blocks' x-coordinates are not modified during
+		// vertical packing, thus they can be considered in advance
+		front.reset();
+		for (Block const* b : blocks) {
+			front.addBoundary(b->bb.ll.x);
+			front.addBoundary(b->bb.ur.x);
+		}
+		front.init();
 
-					// current blocks' intersection
-					cur_intersect = Rect::determineIntersection(neighbor->bb, block->bb);
+		// the outline's y-coordinate is redetermined by the packed blocks
+		this->outline.y = 0.0;
 
-					// initially, consider the full intersection range
-					// as relevant
-					range_checked += cur_intersect.w;
+		// for each block, determine the upper front of all blocks below, i.e.,
+		// of all previously packed blocks intersecting in x-direction, and
+		// perform packing accordingly
+		for (Block const* block : blocks) {
 
-					// check the intersection w/ previous
-					// intersections in order to avoid redundant
-					// considerations of ranges
-					for (Rect const& r : blocks_checked) {
+			// segments covered by block
+			lower = front.segment(block->bb.ll.x);
+			upper = front.segment(block->bb.ur.x);
 
-						cur_prev_intersect = Rect::determineIntersection(cur_intersect, r);
-						// drop the additionally, redundant
-						// covered range
-						if (cur_prev_intersect.w > 0.0) {
-							range_checked -= cur_prev_intersect.w;
-						}
-					}
+			// skip blocks at bottom boundary, they are implicitly packed;
+			// also skip blocks which are successfully aligned; this way, they
+			// keep their position and alignment is not broken
+			if (block->bb.ll.y != 0.0 && block->alignment != Block::AlignmentStatus::SUCCESS) {
 
-					// memorize the actually covered range of the
-					// block front; use a set of rectangles
-					blocks_checked.push_back(cur_intersect);
+				// packed coordinate; sanity check for invalid, i.e.,
+				// overlapping, layouts: blocks are never moved upwards
+				y = min(block->bb.ll.y, front.maxFront(lower, upper));
 
-					// in case the full block front was checked, we
-					// can stop checking other blocks
-					if (Math::doubleComp(block->bb.w, range_checked)) {
-						break;
-					}
-				}
+				// update coordinate on block itself
+				block->bb.ll.y = y;
+				block->bb.ur.y = block->bb.h + y;
 			}
 
-			// update coordinate on block itself, effects the final layout as
-			// well as the currently walked list (which is required for
-			// step-wise packing from bottom to top boundary)
-			block->bb.ll.y = y;
-			block->bb.ur.y = block->bb.h + y;
+			// memorize the block's final coordinates in the front and
+			// outline
+			front.update(lower, upper, block->bb.ur.y);
+			this->outline.y = max(this->outline.y, block->bb.ur.y);
 		}
 	}
 }
@@ -30,6 +30,9 @@
 #include "CornerBlockList.hpp"
 #include "CorblivarAlignmentReq.hpp"
 #include "Coordinate.hpp"
+#include "Contour.hpp"
+#include "CompressedContour.hpp"
+#include "Rect.hpp"
 // forward declarations, if any
 class Block;
 
@@ -37,6 +40,7 @@ class CorblivarDie {
 	// debugging code switch (private)
 	private:
 		static constexpr bool DBG_STACKS = false;
+		static constexpr bool DBG_CONTOURS = false;
 
 	// private data, functions
 	private:
@@ -45,11 +49,65 @@ class CorblivarDie {
 		bool stalled;
 		bool done;
 
+		// layout flags; the layout is outdated starting from the first modified
+		// tuple, i.e., the layout of all preceding tuples is unchanged (max
+		// value for up-to-date layouts), and it's regenerated once it was
+		// (re)generated in the last run of layout generation; w/o alignment,
+		// dies can be handled independently and only outdated layouts have to
+		// be regenerated
+		unsigned outdated_from;
+		bool regenerated;
+		// the blocks of all tuples starting from this one were placed or packed
+		// in the last run of layout generation, i.e., only their geometry may
+		// have changed
+		unsigned regenerated_from;
+
+		// checkpoints of layout generation, i.e., the placement stacks and the
+		// outline before placing every CHECKPOINT_INTERVAL-th tuple, along w/
+		// the (unpacked) bb of all placed blocks; allows to resume layout generation from the
+		// nearest checkpoint preceding the first modified tuple. Checkpoints
+		// are only recorded and considered w/o alignment, since block shifting
+		// and stalling affects the placement stacks and other dies as well
+		static constexpr unsigned CHECKPOINT_INTERVAL = 16;
+		struct Checkpoint {
+			vector<Block const*> Hi, Vi;
+			Point outline;
+		};
+		vector<Checkpoint> checkpoints;
+		unsigned checkpoints_count;
+		vector<Rect> placed_bbs;
+
 		// progress pointer, CBL vector index
 		unsigned pi;
 
-		// placement stacks; for efficiency implemented as list
-		list<Block const*> Hi, Vi;
+		// placement stacks; for efficiency implemented as vectors w/ the top
+		// of stack at the back, i.e., w/o allocations once the vectors reached
+		// their final capacity
+		vector<Block const*> Hi, Vi;
+		// buffers for relevant blocks during placement and for stack backups
+		// during stack rebuilding
+		vector<Block const*> relev_blocks, stack_backup;
+
+		// contours of the CBL's placed prefix, i.e., of all blocks up to the
+		// first yet unplaced block; right front as function of y-coordinates,
+		// upper front as function of x-coordinates. Required for extended
+		// checks during layout generation w/ alignment; thus, they are only
+		// updated on demand, i.e., for such checks, capturing the blocks w/
+		// their current coordinates. Mutable since they are updated while
+		// determining coordinates
+		mutable Contour right_front, upper_front;
+		// count of CBL's blocks captured in contours
+		mutable unsigned contours_blocks;
+
+		// outline of all placed blocks, i.e., their max upper-right
+		// coordinates; maintained during layout generation and packing, thus
+		// available w/o another pass over the blocks
+		Point outline;
+
+		// buffers for packing; blocks sorted by their coordinates, and contour
+		// of packed blocks
+		vector<Block const*> packing_blocks;
+		CompressedContour packing_front;
 
 		// main CBL sequence
 		CornerBlockList CBL;
@@ -57,6 +115,53 @@ class CorblivarDie {
 		// backup CBL sequences
 		CornerBlockList CBLbackup, CBLbest;
 
+		// journal of tuples modified since the last update of a CBL backup;
+		// allows to update and restore backups in proportion to the
+		// modifications, not to the whole CBL
+		struct Journal {
+			// indices of modified tuples, along w/ flags to avoid duplicates
+			vector<unsigned> tuples;
+			vector<bool> flags;
+			// all tuples starting from this index are considered modified,
+			// e.g., after insertion or erasure of tuples
+			unsigned modified_from;
+
+			inline void markTuple(unsigned const& tuple) {
+
+				if (tuple < this->modified_from && !this->flags[tuple]) {
+					this->flags[tuple] = true;
+					this->tuples.push_back(tuple);
+				}
+			};
+
+			inline void markTuples(unsigned const& tuple) {
+				this->modified_from = min(this->modified_from, tuple);
+			};
+
+			inline void reset() {
+
+				for (unsigned const& t : this->tuples) {
+					this->flags[t] = false;
+				}
+				this->tuples.clear();
+				this->modified_from = numeric_limits<unsigned>::max();
+			};
+		};
+		Journal journal_backup, journal_best;
+
+		// journal handler; mark tuple as modified w.r.t. both backups
+		inline void markTupleModified(unsigned const& tuple) {
+			this->journal_backup.markTuple(tuple);
+			this->journal_best.markTuple(tuple);
+			this->outdated_from = min(this->outdated_from, tuple);
+		};
+		// journal handler; mark all tuples starting from given index as modified
+		inline void markTuplesModified(unsigned const& tuple = 0) {
+			this->journal_backup.markTuples(tuple);
+			this->journal_best.markTuples(tuple);
+			this->outdated_from = min(this->outdated_from, tuple);
+		};
+
 		// reset handler
 		inline void reset() {
 
@@ -66,14 +171,102 @@ class CorblivarDie {
 			// reset done flag
 			this->done = false;
 
-			// reset placement stacks
+			// reset placement stacks; note that clearing retains capacities,
+			// reserving is thus only effective once
 			this->Hi.clear();
 			this->Vi.clear();
+			this->Hi.reserve(this->CBL.size());
+			this->Vi.reserve(this->CBL.size());
+			this->relev_blocks.reserve(this->CBL.size());
+			this->stack_backup.reserve(this->CBL.size());
+
+			// reset contours
+			this->resetContours();
+
+			// reset outline
+			this->outline.x = this->outline.y = 0.0;
 
 			// reset placed flags
 			for (Block const* b : this->CBL.S) {
 				b->placed = false;
 			}
+
+			// reset checkpoints
+			this->checkpoints_count = 0;
+			this->placed_bbs.resize(this->CBL.size());
+		};
+
+		// resume handler; restores the state of layout generation from the
+		// nearest checkpoint preceding the first modified tuple, or resets the
+		// die if no such checkpoint is available
+		inline void resume() {
+			unsigned c;
+
+			if (this->checkpoints_count == 0) {
+				this->reset();
+				return;
+			}
+
+			// nearest checkpoint; note that the layout may only be outdated
+			// up to the CBL's end, e.g., after erasing its last tuple
+			c = min(this->outdated_from / CorblivarDie::CHECKPOINT_INTERVAL, this->checkpoints_count - 1);
+			this->checkpoints_count = c + 1;
+
+			// restore progress pointer and done flag
+			this->pi = c * CorblivarDie::CHECKPOINT_INTERVAL;
+			this->done = false;
+
+			// restore placement stacks
+			this->Hi = this->checkpoints[c].Hi;
+			this->Vi = this->checkpoints[c].Vi;
+			this->Hi.reserve(this->CBL.size());
+			this->Vi.reserve(this->CBL.size());
+			this->relev_blocks.reserve(this->CBL.size());
+			this->stack_backup.reserve(this->CBL.size());
+
+			// restore outline of preceding blocks
+			this->outline = this->checkpoints[c].outline;
+
+			// restore bb of preceding blocks, as previously placed; required
+			// since packing may have modified their coordinates
+			for (unsigned t = 0; t < this->pi; t++) {
+				this->CBL.S[t]->bb = this->placed_bbs[t];
+				this->CBL.S[t]->placed = true;
+			}
+			// reset placed flags for remaining blocks
+			for (unsigned t = this->pi; t < this->CBL.size(); t++) {
+				this->CBL.S[t]->placed = false;
+			}
+			this->placed_bbs.resize(this->CBL.size());
+
+			// note that the contours are not restored, but only reset; they
+			// are only required w/ alignment, where layouts are always fully
+			// regenerated
+			this->resetContours();
+		};
+
+		// checkpoint handler; memorize placement stacks before placing the
+		// current block, if required
+		inline void recordCheckpoint() {
+			unsigned c;
+
+			if (this->pi % CorblivarDie::CHECKPOINT_INTERVAL != 0) {
+				return;
+			}
+
+			c = this->pi / CorblivarDie::CHECKPOINT_INTERVAL;
+
+			if (c == this->checkpoints.size()) {
+				this->checkpoints.emplace_back();
+			}
+
+			// note that assigning retains capacities, i.e., avoids
+			// allocations once the vectors reached their final capacity
+			this->checkpoints[c].Hi = this->Hi;
+			this->checkpoints[c].Vi = this->Vi;
+			this->checkpoints[c].outline = this->outline;
+
+			this->checkpoints_count = c + 1;
 		};
 
 		// handler for progress pointer, flag
@@ -88,27 +281,107 @@ class CorblivarDie {
 
 		// layout generation; place current block
 		void placeCurrentBlock(bool const& alignment_enabled);
+		// layout generation w/o alignment; place all remaining blocks, only
+		// considering this die
+		inline void placeRemainingBlocks() {
+
+			while (!this->done) {
+				this->placeCurrentBlock(false);
+				this->updateProgressPointerFlag();
+			}
+		};
+		// contours handler; reset contours, buffers are reserved for all blocks
+		inline void resetContours() const {
+
+			this->right_front.reset(this->CBL.size());
+			this->upper_front.reset(this->CBL.size());
+			this->contours_blocks = 0;
+		};
+		// contours handler; capture the blocks of the CBL's placed prefix which
+		// are not captured yet, w/ their current coordinates
+		inline void updateContours() const {
+
+			while (this->contours_blocks < this->CBL.size() && this->CBL.S[this->contours_blocks]->placed) {
+
+				Block const* block = this->CBL.S[this->contours_blocks];
+
+				this->right_front.update(block->bb.ll.y, block->bb.ur.y, block->bb.ur.x);
+				this->upper_front.update(block->bb.ll.x, block->bb.ur.x, block->bb.ur.y);
+
+				this->contours_blocks++;
+			}
+		};
+		// contours handler; the current block's coordinates are to be modified;
+		// if the block is already captured, the contours are outdated and have to
+		// be rebuilt. Note that only the current block is modified during layout
+		// generation, i.e., by determining its coordinates or by shifting it
+		inline void currentBlockModified() const {
+
+			if (this->pi < this->contours_blocks) {
+				this->resetContours();
+			}
+		};
+
+		// layout generation; mark block as placed, memorize its coordinates in
+		// outline
+		inline void markAsPlaced(Block const* block) {
+
+			block->placed = true;
+
+			this->outline.x = max(this->outline.x, block->bb.ur.x);
+			this->outline.y = max(this->outline.y, block->bb.ur.y);
+		};
+		// layout generation; redetermine outline from all blocks
+		inline void determOutline() {
+
+			this->outline.x = this->outline.y = 0.0;
+
+			for (Block const* block : this->CBL.S) {
+				this->outline.x = max(this->outline.x, block->bb.ur.x);
+				this->outline.y = max(this->outline.y, block->bb.ur.y);
+			}
+		};
 		// layout generation: block shifting
 		bool shiftCurrentBlock(Direction const& dir, CorblivarAlignmentReq const* req, bool const& dry_run = false);
 
 		// layout-generation helper: determine coordinates of block in process
-		void determCurrentBlockCoords(Coordinate const& coord, list<Block const*> const& relev_blocks_stack, bool const& extended_check = false) const;
+		void determCurrentBlockCoords(Coordinate const& coord, vector<Block const*> const& relev_blocks_stack, bool const& extended_check = false) const;
 		// layout-generation helper: pop relevant blocks to consider during
-		// placement from stacks
-		list<Block const*> popRelevantBlocks();
+		// placement from stacks; relevant blocks are put into the given buffer,
+		// ordered from top to bottom of stack
+		void popRelevantBlocks(vector<Block const*>& relev_blocks_stack);
 		// layout-generation helper: update placement stack (after placement)
-		void updatePlacementStacks(list<Block const*>& relev_blocks_stack);
+		void updatePlacementStacks(vector<Block const*> const& relev_blocks_stack);
 		// layout-generation helper: rebuild placement stack (after block shifting)
-		void rebuildPlacementStacks(list<Block const*>& relev_blocks_stack);
+		void rebuildPlacementStacks(vector<Block const*> const& relev_blocks_stack);
+		// layout-generation helper: sort stack (in-place, stable insertion sort
+		// w/o allocations); the top of stack has to be first w.r.t. the given
+		// strict order
+		template<typename Order>
+		static void sortStack(vector<Block const*>& stack, Order const& top_first);
 		// layout-generation helper: placement stacks debugging
 		void debugStacks();
 
 	// constructors, destructors, if any non-implicit
 	public:
-		CorblivarDie(int const& id) {
+		CorblivarDie(int const& id, unsigned const& blocks) {
 			this->stalled = false;
 			this->done = false;
+			this->outdated_from = 0;
+			this->regenerated = false;
+			this->regenerated_from = 0;
+			this->contours_blocks = 0;
+			this->checkpoints_count = 0;
+			this->outline.x = this->outline.y = 0.0;
 			this->id = id;
+
+			// init journals; all tuples are initially considered as modified,
+			// since no backups are available yet
+			this->journal_backup.flags.resize(blocks, false);
+			this->journal_best.flags.resize(blocks, false);
+			this->journal_backup.reset();
+			this->journal_best.reset();
+			this->markTuplesModified();
 		}
 
 	// public data, functions
@@ -136,18 +409,19 @@ class CorblivarDie {
 		inline Direction const& getCurrentDirection() const {
 			return this->CBL.L[this->pi];
 		};
+		inline Direction const& getDirection(unsigned const& tuple) const {
+			return this->CBL.L[tuple];
+		};
 		inline unsigned const& getJunctions(unsigned const& tuple) const {
 			return this->CBL.T[tuple];
 		};
-		inline int getTuple(Block const* block) const {
-			int index;
-
-			for (index = 0; index < static_cast<int>(this->CBL.S.size()); index++) {
-				if (block->id == this->CBL.S[index]->id) {
-					return index;
-				}
-			}
-			return -1;
+		inline Point const& getOutline() const {
+			return this->outline;
+		};
+		// first tuple whose block was placed or packed in the last run of layout
+		// generation; CBL size for retained layouts
+		inline unsigned getRegeneratedFrom() const {
+			return this->regenerated ? this->regenerated_from : this->CBL.size();
 		};
 
 		// layout generation: packing, to be performed as post-placement operation
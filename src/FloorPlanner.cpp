@@ -289,6 +289,565 @@ bool FloorPlanner::performSA(CorblivarCore& corb) {
 	return valid_layout_found;
 }
 
+// handler for multiple, concurrent SA chains; each chain runs on a copy of the
+// floorplanner and on its own CBLs, the best solution is finally handed back to corb
+bool FloorPlanner::performSAChains(CorblivarCore& corb) {
+	int c, best_chain;
+	double cur_cost, best_cost;
+	FloorPlanner const* ref_chain;
+	vector<FloorPlanner> chains;
+	vector<CorblivarCore> chains_corb;
+	vector<int> chains_done;
+	vector<unsigned> chains_seeds;
+	vector<thread> threads;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "-> FloorPlanner::performSAChains(" << &corb << ")" << endl;
+	}
+
+	// init chains; note that all vectors have to be fully allocated before the
+	// threads are started, since the chains refer to their own data by pointers
+	chains.reserve(this->SA_parameters.chains);
+	chains_corb.reserve(this->SA_parameters.chains);
+	chains_done.assign(this->SA_parameters.chains, 0);
+
+	for (c = 0; c < this->SA_parameters.chains; c++) {
+
+		chains.push_back(*this);
+		chains_corb.push_back(CorblivarCore(this->IC.layers, this->blocks.size()));
+		chains[c].initChain(*this, chains_corb[c], corb);
+
+		// seeds for chains are derived from this floorplanner's generator; i.e.,
+		// each chain has its own random-number sequence
+		chains_seeds.push_back(Math::randI(0, RAND_MAX));
+	}
+
+	if (this->logMed()) {
+		cout << "SA> Running " << this->SA_parameters.chains << " SA chains concurrently ..." << endl;
+	}
+
+	// run chains; each chain is initialized w/ a different random data set
+	for (c = 0; c < this->SA_parameters.chains; c++) {
+
+		threads.push_back(thread([this, c, &chains, &chains_corb, &chains_done, &chains_seeds]() {
+
+			Math::initRand(chains_seeds[c]);
+
+			chains_corb[c].initCorblivarRandomly(false, this->IC.layers, chains[c].blocks,
+				this->SA_parameters.layout_power_aware_block_handling);
+
+			chains_done[c] = chains[c].performSA(chains_corb[c]);
+		}));
+	}
+	for (thread& th : threads) {
+		th.join();
+	}
+
+	// determine best solution; the costs of different chains are normalized w/
+	// different max cost values, thus all chains' best solutions are re-evaluated
+	// w/ the max cost values of the first successful chain
+	ref_chain = nullptr;
+	best_chain = -1;
+	best_cost = 0.0;
+
+	for (c = 0; c < this->SA_parameters.chains; c++) {
+
+		if (!chains_done[c]) {
+
+			if (this->logMed()) {
+				cout << "SA>  Chain " << c << ": no fitting solution" << endl;
+			}
+
+			continue;
+		}
+
+		if (ref_chain == nullptr) {
+			ref_chain = &chains[c];
+		}
+		else {
+			chains[c].max_cost_WL = ref_chain->max_cost_WL;
+			chains[c].max_cost_TSVs = ref_chain->max_cost_TSVs;
+			chains[c].max_cost_thermal = ref_chain->max_cost_thermal;
+			chains[c].max_cost_alignments = ref_chain->max_cost_alignments;
+		}
+
+		chains_corb[c].applyBestCBLs(false);
+		chains[c].generateLayout(chains_corb[c], this->SA_parameters.opt_alignment);
+		cur_cost = chains[c].evaluateLayout(chains_corb[c].getAlignments(), 1.0, true).total_cost_fitting;
+
+		if (this->logMed()) {
+			cout << "SA>  Chain " << c << ": best solution's cost: " << cur_cost << endl;
+		}
+
+		if (best_chain == -1 || cur_cost < best_cost) {
+			best_chain = c;
+			best_cost = cur_cost;
+		}
+	}
+
+	// no chain was successful; keep temperature schedule of first chain for logging
+	if (best_chain == -1) {
+		this->tempSchedule = chains[0].tempSchedule;
+	}
+	// hand best solution back, i.e., rebuild the CBLs w/ this floorplanner's blocks
+	// and memorize them as best solution
+	else {
+		if (this->logMed()) {
+			cout << "SA> Best solution found by chain " << best_chain << endl;
+			cout << endl;
+		}
+
+		this->adoptChainSolution(corb, chains[best_chain], chains_corb[best_chain]);
+
+		this->tempSchedule = chains[best_chain].tempSchedule;
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "<- FloorPlanner::performSAChains : " << (best_chain != -1) << endl;
+	}
+
+	return (best_chain != -1);
+}
+
+// handler for replica-exchange SA, i.e., parallel tempering; replicas are annealed at
+// fixed temperatures of a ladder and concurrently, their states are exchanged after
+// each step via the Metropolis exchange criterion
+bool FloorPlanner::performSATempering(CorblivarCore& corb) {
+	int i, k, r, r1, r2;
+	int replicas;
+	int exchanges, exchanges_tried;
+	int exchanges_adaption, exchanges_tried_adaption;
+	int best_rep;
+	unsigned rand_state;
+	double init_temp, init_cost_std_dev, temp_step, temp_ratio, temp_scale, delta, ratio;
+	double acceptance;
+	bool SA_phase_two, SA_phase_two_init;
+	vector<FloorPlanner> reps_fp;
+	vector<CorblivarCore> reps_corb;
+	vector<Replica> reps;
+	vector<int> ladder;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "-> FloorPlanner::performSATempering(" << &corb << ")" << endl;
+	}
+
+	replicas = this->SA_parameters.replicas;
+
+	// persistent pool for handling the replicas concurrently; the calling thread
+	// also handles replicas, thus one thread less is required
+	ThreadPool pool(min(static_cast<unsigned>(replicas), max(thread::hardware_concurrency(), 1u)) - 1);
+
+	// init replicas; note that all vectors have to be fully allocated before the
+	// replicas are handled, since the replicas refer to their own data by pointers
+	reps_fp.reserve(replicas);
+	reps_corb.reserve(replicas);
+	reps.assign(replicas, Replica());
+
+	for (r = 0; r < replicas; r++) {
+
+		reps_fp.push_back(*this);
+		reps_corb.push_back(CorblivarCore(this->IC.layers, this->blocks.size()));
+		reps_fp[r].initChain(*this, reps_corb[r], corb);
+
+		// seeds for replicas are derived from this floorplanner's generator;
+		// note that the generator state has to be maintained w/ the replica
+		// since replicas are handled by any of the pool's threads for each step
+		reps[r].rand_state = Math::randI(0, RAND_MAX);
+	}
+
+	if (this->logMed()) {
+		cout << "SA> Perform replica-exchange SA w/ " << replicas << " replicas ..." << endl;
+	}
+
+	// memorize this floorplanner's generator state; the calling thread also
+	// handles replicas, which continue their own sequences
+	rand_state = Math::randState();
+
+	// init replicas' data sets and initial sampling, concurrently
+	pool.run(replicas, [this, &reps_fp, &reps_corb, &reps](unsigned const& r) {
+		vector<double> cost_samples;
+
+		Math::initRand(reps[r].rand_state);
+
+		reps_corb[r].initCorblivarRandomly(false, this->IC.layers, reps_fp[r].blocks,
+			this->SA_parameters.layout_power_aware_block_handling);
+
+		// floorplacement handling, see performSA
+		if (this->SA_parameters.layout_floorplacement) {
+			reps_corb[r].sortCBLs(false, CorblivarCore::SORT_CBLS_BY_BLOCKS_SIZE);
+		}
+
+		reps_fp[r].initSA(reps_corb[r], cost_samples, reps[r].innerLoopMax, reps[r].init_temp);
+
+		reps[r].rand_state = Math::randState();
+	});
+
+	Math::initRand(rand_state);
+
+	// init temperature ladder, starting from the avg initial temperature of all
+	// replicas; ladder[0] refers to hottest replica
+	init_temp = 0.0;
+	for (Replica const& rep : reps) {
+		init_temp += rep.init_temp;
+	}
+	init_temp /= replicas;
+
+	// initial width of ladder; the exchange of adjacent replicas is accepted w/
+	// probability exp(-dB * dC), for dB as difference of their inverse
+	// temperatures and dC as difference of their costs; the latter is estimated
+	// by the std dev of costs from the initial sampling, see initSA. The ladder's
+	// ratio is thus given by equally spaced inverse temperatures, for which the
+	// targeted acceptance rate is expected for all pairs. Since costs spread less
+	// at lower temperatures, the estimate is conservative, i.e., the ladder is
+	// widened during the run, considering the actual acceptance rate
+	init_cost_std_dev = init_temp / this->SA_parameters.temp_init_factor;
+	temp_step = -std::log(FloorPlanner::SA_TEMPERING_EXCHANGE_ACCEPTANCE_MAX) / init_cost_std_dev;
+	temp_ratio = 1.0 / (1.0 + (replicas - 1) * temp_step * init_temp);
+	temp_ratio = max(temp_ratio, FloorPlanner::SA_TEMPERING_TEMP_RATIO_MIN);
+
+	for (r = 0; r < replicas; r++) {
+
+		reps[r].fitting_layouts_ratio = 0.0;
+		reps[r].valid_layout_found = false;
+		reps[r].fitting_layout_found = false;
+
+		ladder.push_back(r);
+	}
+	FloorPlanner::setTemperingLadder(reps, ladder, init_temp, temp_ratio);
+
+	// reset temperature-schedule log
+	this->tempSchedule.clear();
+
+	/// main loop; replica steps and exchanges
+	//
+	SA_phase_two = false;
+	exchanges = exchanges_tried = 0;
+	exchanges_adaption = exchanges_tried_adaption = 0;
+	best_rep = -1;
+
+	for (i = 1; i <= this->SA_parameters.loopLimit; i++) {
+
+		// perform fixed-temperature steps for all replicas, concurrently
+		rand_state = Math::randState();
+
+		pool.run(replicas, [SA_phase_two, &reps_fp, &reps_corb, &reps](unsigned const& r) {
+			reps_fp[r].performSAReplicaSteps(reps_corb[r], reps[r], SA_phase_two);
+		});
+
+		Math::initRand(rand_state);
+
+		// switch to SA phase two when first fitting solution is found by any
+		// replica; initialize max cost terms w/ that replica's layout and share
+		// them w/ all replicas, such that replicas' costs remain comparable
+		SA_phase_two_init = false;
+		if (!SA_phase_two) {
+
+			for (r = 0; r < replicas; r++) {
+
+				if (!reps[r].fitting_layout_found) {
+					continue;
+				}
+
+				SA_phase_two = SA_phase_two_init = true;
+
+				reps[r].best_cost = reps_fp[r].evaluateLayout(reps_corb[r].getAlignments(), 1.0, true, true).total_cost_fitting;
+
+				// rescale temperatures to the phase-two cost function; the
+				// scale is given by this replica's layout, evaluated w/ the
+				// cost functions of both phases; the ratios of the ladder are
+				// maintained
+				temp_scale = FloorPlanner::replicaCost(reps[r], 1.0, false);
+				if (temp_scale > 0.0) {
+					temp_scale = reps[r].best_cost / temp_scale;
+
+					for (Replica& rep : reps) {
+						rep.temp *= temp_scale;
+					}
+					init_temp *= temp_scale;
+				}
+				reps[r].valid_layout_found = reps[r].best_sol_found = true;
+				reps_corb[r].storeBestCBLs();
+
+				for (FloorPlanner& rep_fp : reps_fp) {
+					rep_fp.max_cost_WL = reps_fp[r].max_cost_WL;
+					rep_fp.max_cost_TSVs = reps_fp[r].max_cost_TSVs;
+					rep_fp.max_cost_thermal = reps_fp[r].max_cost_thermal;
+					rep_fp.max_cost_alignments = reps_fp[r].max_cost_alignments;
+				}
+
+				if (this->logMed()) {
+					cout << "SA> Phase II: optimizing within outline; switch cost function ..." << endl;
+				}
+
+				break;
+			}
+		}
+
+		// replica exchange for adjacent temperatures; alternating even and odd
+		// pairs; skipped during phase transition since costs are not comparable
+		if (!SA_phase_two_init) {
+
+			for (k = (i % 2); k + 1 < replicas; k += 2) {
+
+				r1 = ladder[k];
+				r2 = ladder[k + 1];
+
+				// Metropolis exchange criterion; the replicas' costs are
+				// compared w/ a common fitting ratio, since the ratios of the
+				// replicas differ and impact the cost terms
+				ratio = 0.5 * (reps[r1].fitting_layouts_ratio + reps[r2].fitting_layouts_ratio);
+				delta = (1.0 / reps[r1].temp - 1.0 / reps[r2].temp) *
+					(FloorPlanner::replicaCost(reps[r1], ratio, SA_phase_two) - FloorPlanner::replicaCost(reps[r2], ratio, SA_phase_two));
+
+				exchanges_tried++;
+				exchanges_tried_adaption++;
+
+				if (delta >= 0.0 || Math::randF(0, 1) < exp(delta)) {
+
+					swap(reps[r1].temp, reps[r2].temp);
+					swap(ladder[k], ladder[k + 1]);
+
+					exchanges++;
+					exchanges_adaption++;
+				}
+			}
+		}
+
+		// adapt ladder to targeted acceptance rate; widen the ladder, i.e.,
+		// lower the colder replicas' temperatures, for frequent exchanges and
+		// narrow it for rare exchanges
+		if (i % FloorPlanner::SA_TEMPERING_LADDER_ADAPTION_STEPS == 0 && exchanges_tried_adaption > 0) {
+
+			acceptance = static_cast<double>(exchanges_adaption) / exchanges_tried_adaption;
+
+			if (acceptance > FloorPlanner::SA_TEMPERING_EXCHANGE_ACCEPTANCE_MAX) {
+				temp_ratio = max(pow(temp_ratio, 1.5), FloorPlanner::SA_TEMPERING_TEMP_RATIO_MIN);
+			}
+			else if (acceptance < FloorPlanner::SA_TEMPERING_EXCHANGE_ACCEPTANCE_MIN) {
+				temp_ratio = pow(temp_ratio, 0.75);
+			}
+			FloorPlanner::setTemperingLadder(reps, ladder, init_temp, temp_ratio);
+
+			if (this->logMax()) {
+				cout << "SA> Ladder adaption; acceptance rate: " << acceptance << ", ratio of temperatures: " << temp_ratio << endl;
+			}
+
+			exchanges_adaption = exchanges_tried_adaption = 0;
+		}
+
+		// log temperature step; consider coldest replica
+		best_rep = -1;
+		for (r = 0; r < replicas; r++) {
+			if (reps[r].valid_layout_found && (best_rep == -1 || reps[r].best_cost < reps[best_rep].best_cost)) {
+				best_rep = r;
+			}
+		}
+
+		TempStep cur_step;
+		cur_step.step = i;
+		cur_step.temp = reps[ladder[replicas - 1]].temp;
+		cur_step.avg_cost = reps[ladder[replicas - 1]].avg_cost;
+		cur_step.new_best_sol_found = (best_rep != -1) && reps[best_rep].best_sol_found;
+		cur_step.cost_best_sol = (best_rep != -1) ? reps[best_rep].best_cost : 0.0;
+		this->tempSchedule.push_back(move(cur_step));
+
+		if (this->logMax()) {
+			cout << "SA> Optimization step: " << i << "/" << this->SA_parameters.loopLimit << endl;
+			cout << "SA>  coldest replica's avg cost: " << cur_step.avg_cost << endl;
+			cout << "SA>  exchanges so far: " << exchanges << endl;
+			cout << "SA>  coldest replica's temp: " << cur_step.temp << endl;
+		}
+
+	}
+
+	// hand back best solution
+	if (best_rep != -1) {
+
+		reps_corb[best_rep].applyBestCBLs(false);
+		this->adoptChainSolution(corb, reps_fp[best_rep], reps_corb[best_rep]);
+	}
+
+	if (this->logMed()) {
+		cout << "SA> Done; replica exchanges: " << exchanges << "/" << exchanges_tried;
+		cout << " (acceptance rate: " << ((exchanges_tried > 0) ? static_cast<double>(exchanges) / exchanges_tried : 0.0) << ")";
+		cout << "; final ratio of temperatures: " << temp_ratio << endl;
+		cout << endl;
+	}
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "<- FloorPlanner::performSATempering : " << (best_rep != -1) << endl;
+	}
+
+	return (best_rep != -1);
+}
+
+// fixed-temperature SA steps for one replica; in phase one, the steps are stopped once a
+// fitting layout is found
+void FloorPlanner::performSAReplicaSteps(CorblivarCore& corb, Replica& rep, bool const& SA_phase_two) {
+	int ii;
+	int accepted_ops;
+	int layout_fit_counter;
+	bool op_success, accept;
+	double prev_cost, cost_diff;
+	double prev_area, prev_outline, prev_cost_others;
+	Cost cost;
+
+	// continue replica's random-number sequence
+	Math::initRand(rep.rand_state);
+
+	// init loop parameters
+	ii = 1;
+	accepted_ops = 0;
+	layout_fit_counter = 0;
+	rep.avg_cost = 0.0;
+	rep.best_sol_found = false;
+	rep.fitting_layout_found = false;
+
+	// init cost for current layout
+	this->generateLayout(corb, this->SA_parameters.opt_alignment && SA_phase_two);
+	cost = this->evaluateLayout(corb.getAlignments(), rep.fitting_layouts_ratio, SA_phase_two);
+	FloorPlanner::memorizeReplicaCost(rep, cost, SA_phase_two);
+
+	while (ii <= rep.innerLoopMax) {
+
+		op_success = this->performRandomLayoutOp(corb, SA_phase_two);
+
+		if (!op_success) {
+			continue;
+		}
+
+		prev_cost = rep.cur_cost;
+		prev_area = rep.cur_area;
+		prev_outline = rep.cur_outline;
+		prev_cost_others = rep.cur_cost_others;
+
+		this->generateLayout(corb, this->SA_parameters.opt_alignment && SA_phase_two);
+		cost = this->evaluateLayout(corb.getAlignments(), rep.fitting_layouts_ratio, SA_phase_two);
+		FloorPlanner::memorizeReplicaCost(rep, cost, SA_phase_two);
+		cost_diff = rep.cur_cost - prev_cost;
+
+		// revert solution w/ worse or same cost, depending on temperature
+		accept = true;
+		if (cost_diff >= 0.0 && Math::randF(0, 1) > exp(- cost_diff / rep.temp)) {
+
+			accept = false;
+
+			this->performRandomLayoutOp(corb, SA_phase_two, true);
+			rep.cur_cost = prev_cost;
+			rep.cur_area = prev_area;
+			rep.cur_outline = prev_outline;
+			rep.cur_cost_others = prev_cost_others;
+		}
+
+		if (accept) {
+			accepted_ops++;
+			rep.avg_cost += rep.cur_cost;
+
+			if (cost.fits_fixed_outline) {
+				layout_fit_counter++;
+
+				// phase one: stop steps, such that phase two can be
+				// initialized for all replicas
+				if (!SA_phase_two) {
+					rep.fitting_layout_found = true;
+					break;
+				}
+
+				// memorize best solution which fits into outline
+				if (cost.total_cost_fitting < rep.best_cost || !rep.valid_layout_found) {
+
+					rep.best_cost = cost.total_cost_fitting;
+					corb.storeBestCBLs();
+					rep.valid_layout_found = rep.best_sol_found = true;
+				}
+			}
+		}
+
+		ii++;
+	}
+
+	// determine ratio of solutions fitting into outline, and avg cost
+	if (accepted_ops > 0) {
+		rep.fitting_layouts_ratio = static_cast<double>(layout_fit_counter) / accepted_ops;
+		rep.avg_cost /= accepted_ops;
+	}
+	else {
+		rep.fitting_layouts_ratio = 0.0;
+	}
+
+	// memorize replica's random-number sequence
+	rep.rand_state = Math::randState();
+}
+
+// rebuild the chain's current CBLs w/ this floorplanner's blocks and memorize them as
+// best solution; also adopt the chain's cost normalization
+void FloorPlanner::adoptChainSolution(CorblivarCore& corb, FloorPlanner const& chain, CorblivarCore const& chain_corb) {
+	unsigned t;
+
+	for (int d = 0; d < this->IC.layers; d++) {
+
+		CorblivarDie const& chain_die = chain_corb.getDie(d);
+		CornerBlockList& CBL = corb.editDie(d).editCBL();
+
+		CBL.clear();
+
+		for (t = 0; t < chain_die.getCBL().size(); t++) {
+
+			Block const* b = this->mapBlock(chain_die.getBlock(t), chain);
+
+			b->bb = chain_die.getBlock(t)->bb;
+			b->layer = d;
+
+			CBL.insert({b, chain_die.getDirection(t), chain_die.getJunctions(t)});
+		}
+	}
+
+	corb.handleEditedCBLs();
+	corb.storeBestCBLs();
+
+	// blocks were placed w/o layout generation; the geometry store has to be
+	// updated for all blocks
+	this->geometry.valid = false;
+
+	this->max_cost_WL = chain.max_cost_WL;
+	this->max_cost_TSVs = chain.max_cost_TSVs;
+	this->max_cost_thermal = chain.max_cost_thermal;
+	this->max_cost_alignments = chain.max_cost_alignments;
+}
+
+void FloorPlanner::initChain(FloorPlanner const& fp, CorblivarCore& chain_corb, CorblivarCore const& corb) {
+
+	// reduce logging; chains run concurrently
+	if (fp.log > FloorPlanner::LOG_MINIMAL) {
+		this->log = FloorPlanner::LOG_MINIMAL;
+	}
+
+	// chains run concurrently, thus nets are evaluated serially w/in chains; the
+	// thread pool is not to be shared
+	this->thread_pool = nullptr;
+
+	// alignments shall be evaluated for the chain's own requests and blocks
+	this->alignments_cache.valid = false;
+
+	// the geometry store shall be updated for the chain's own blocks
+	this->geometry.valid = false;
+
+	// note that the netlist refers to blocks by their numerical ids, i.e., it
+	// applies to the chain's own blocks as well; terminal pins are not modified
+	// during SA and are thus shared w/ the original floorplanner
+
+	// alignment requests shall also refer to the chain's own blocks
+	chain_corb.editAlignments().reserve(corb.getAlignments().size());
+	for (CorblivarAlignmentReq const& req : corb.getAlignments()) {
+
+		chain_corb.editAlignments().push_back(req);
+		chain_corb.editAlignments().back().s_i = this->mapBlock(req.s_i, fp);
+		chain_corb.editAlignments().back().s_j = this->mapBlock(req.s_j, fp);
+	}
+	// init related adjacency of blocks and alignment requests
+	chain_corb.initAlignmentReqsAdjacency(this->blocks.size());
+}
+
 void FloorPlanner::updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const {
 	float loop_factor;
 	double prev_temp;
@@ -459,6 +1018,29 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 		this->generateLayout(corb, this->SA_parameters.opt_alignment);
 	}
 
+	// blocks were placed w/o layout generation, i.e., they were parsed from a
+	// solution file; update geometry store and determine outline of blocks on
+	// each die for all blocks
+	else {
+		this->geometry.update(this->blocks);
+
+		this->dies_outline.assign(this->IC.layers, Point());
+		for (Point& outline : this->dies_outline) {
+			outline.x = outline.y = 0.0;
+		}
+
+		for (Block const& b : this->blocks) {
+
+			// ignore blocks w/o any layer, i.e., not parsed
+			if (b.layer < 0 || b.layer >= this->IC.layers) {
+				continue;
+			}
+
+			this->dies_outline[b.layer].x = max(this->dies_outline[b.layer].x, b.bb.ur.x);
+			this->dies_outline[b.layer].y = max(this->dies_outline[b.layer].y, b.bb.ur.y);
+		}
+	}
+
 	// determine final cost, also for non-Corblivar calls
 	if (!handle_corblivar || valid_solution) {
 
@@ -567,40 +1149,57 @@ void FloorPlanner::finalize(CorblivarCore& corb, bool const& determ_overall_cost
 
 bool FloorPlanner::generateLayout(CorblivarCore& corb, bool const& perform_alignment) {
 	bool ret;
+	bool lazy;
 
-	// generate layout
-	ret = corb.generateLayout(perform_alignment);
+	// generate layout; lazy generation, i.e., only for dies w/ modified tuples,
+	// is feasible w/o alignment, but not if packing considers the alignment
+	// status of blocks (see below); this status depends on the unpacked layout of
+	// all dies
+	lazy = !perform_alignment &&
+		!(this->SA_parameters.opt_alignment && this->SA_parameters.layout_packing_iterations > 0 && !corb.getAlignments().empty());
+	ret = corb.generateLayout(perform_alignment, lazy);
 
 	// annotate alignment success/failure in blocks; required for maintaining
 	// succeeded alignments during subsequent packing
 	if (this->SA_parameters.opt_alignment && this->SA_parameters.layout_packing_iterations > 0) {
 		// ignore related cost; use dummy variable
 		Cost dummy;
-		// also don't derive TSVs; not required here
-		this->evaluateAlignments(dummy, corb.getAlignments(), false);
+		this->evaluateAlignments(dummy, corb.getAlignments());
 	}
 
-	// perform packing if desired; perform on each die for each
-	// dimension separately and subsequently; multiple iterations may
-	// provide denser packing configurations
-	for (int d = 0; d < this->IC.layers; d++) {
+	// perform packing if desired
+	corb.performPacking(this->SA_parameters.layout_packing_iterations);
 
-		CorblivarDie& die = corb.editDie(d);
+	// update blocks' geometry store; only blocks placed or packed during this run
+	// may have changed, i.e., blocks of retained layouts are not considered
+	if (!this->geometry.valid) {
+		this->geometry.update(this->blocks);
+	}
+	else {
+		for (int d = 0; d < this->IC.layers; d++) {
 
-		// sanity check for empty dies
-		if (!die.getCBL().empty()) {
+			CorblivarDie const& die = corb.getDie(d);
 
-			for (int i = 1; i <= this->SA_parameters.layout_packing_iterations; i++) {
-				die.performPacking(Direction::HORIZONTAL);
-				die.performPacking(Direction::VERTICAL);
+			for (unsigned t = die.getRegeneratedFrom(); t < die.getCBL().size(); t++) {
+				this->geometry.update(*die.getBlock(t));
 			}
 		}
+	}
+
+	// memorize outline of blocks on all dies; maintained during layout
+	// generation and packing, i.e., available w/o another pass over the blocks
+	this->dies_outline.resize(this->IC.layers);
+	for (int d = 0; d < this->IC.layers; d++) {
+		this->dies_outline[d] = corb.getDie(d).getOutline();
+	}
 
-		// dbg: sanity check for valid layout
-		if (CorblivarCore::DBG_VALID_LAYOUT) {
+	// dbg: sanity check for valid layout
+	if (CorblivarCore::DBG_VALID_LAYOUT) {
+
+		for (int d = 0; d < this->IC.layers; d++) {
 
 			// if true, the layout is buggy, i.e., invalid
-			if (die.debugLayout()) {
+			if (corb.getDie(d).debugLayout()) {
 				return false;
 			}
 		}
@@ -722,18 +1321,18 @@ bool FloorPlanner::prepareBlockSwappingFailedAlignment(CorblivarCore const& corb
 		// required
 		if (
 			// randomly select s_i if it's not the RBOD
-			(failed_req->s_i->id != "RBOD" && Math::randB()) ||
+			(failed_req->s_i->numerical_id != Block::NUMERICAL_ID_RBOD && Math::randB()) ||
 			// if s_j is the RBOD, we need to use s_i; assuming that
 			// only s_i OR s_j are the RBOD
-			failed_req->s_j->id == "RBOD"
+			failed_req->s_j->numerical_id == Block::NUMERICAL_ID_RBOD
 		   ) {
 			die1 = die2 = failed_req->s_i->layer;
-			tuple1 = corb.getDie(die1).getTuple(failed_req->s_i);
+			tuple1 = corb.getTuple(failed_req->s_i);
 			b1 = failed_req->s_i;
 		}
 		else {
 			die1 = die2 = failed_req->s_j->layer;
-			tuple1 = corb.getDie(die1).getTuple(failed_req->s_j);
+			tuple1 = corb.getTuple(failed_req->s_j);
 			b1 = failed_req->s_j;
 		}
 
@@ -767,8 +1366,8 @@ bool FloorPlanner::prepareBlockSwappingFailedAlignment(CorblivarCore const& corb
 					// however, this should not be the partner block
 					// of the alignment request
 					if (
-						(b1->id == failed_req->s_i->id && b2->id == failed_req->s_j->id) ||
-						(b1->id == failed_req->s_j->id && b2->id == failed_req->s_i->id)
+						(b1->numerical_id == failed_req->s_i->numerical_id && b2->numerical_id == failed_req->s_j->numerical_id) ||
+						(b1->numerical_id == failed_req->s_j->numerical_id && b2->numerical_id == failed_req->s_i->numerical_id)
 					   ) {
 						continue;
 					}
@@ -866,7 +1465,7 @@ bool FloorPlanner::prepareBlockSwappingFailedAlignment(CorblivarCore const& corb
 		// cannot be find; sanity check for undefined neighbour
 		if (b1_neighbour != nullptr) {
 
-			tuple2 = corb.getDie(die2).getTuple(b1_neighbour);
+			tuple2 = corb.getTuple(b1_neighbour);
 
 			if (FloorPlanner::DBG_ALIGNMENT) {
 				cout << "DBG_ALIGNMENT> " << failed_req->tupleString() << " failed so far;" << endl;
@@ -909,6 +1508,8 @@ bool FloorPlanner::performOpShapeBlock(bool const& revert, CorblivarCore& corb,
 
 		// determine related block to be shaped
 		shape_block = corb.getDie(die1).getBlock(tuple1);
+		// memorize related tuple as modified
+		corb.markTupleModified(die1, tuple1);
 
 		// backup current shape
 		shape_block->bb_backup = shape_block->bb;
@@ -944,6 +1545,7 @@ bool FloorPlanner::performOpShapeBlock(bool const& revert, CorblivarCore& corb,
 		// revert by restoring backup bb
 		corb.getDie(this->last_op_die1).getBlock(this->last_op_tuple1)->bb =
 			corb.getDie(this->last_op_die1).getBlock(this->last_op_tuple1)->bb_backup;
+		corb.markTupleModified(this->last_op_die1, this->last_op_tuple1);
 	}
 
 	return true;
@@ -1295,9 +1897,6 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(vector<CorblivarAlignmentReq> co
 	}
 	// phase two: consider further cost factors
 	else {
-		// reset TSVs
-		this->TSVs.clear();
-
 		// area and outline cost, already weighted w/ global weight factor
 		this->evaluateAreaOutline(cost, fitting_layouts_ratio);
 
@@ -1321,12 +1920,12 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(vector<CorblivarAlignmentReq> co
 		// failed request, this provides feedback for further alignment
 		// optimization
 		if (this->SA_parameters.opt_alignment) {
-			this->evaluateAlignments(cost, alignments, true, set_max_cost);
+			this->evaluateAlignments(cost, alignments, set_max_cost);
 		}
 		// for finalize calls and when no cost was previously determined, we need
 		// to initialize the max_cost
 		else if (finalize) {
-			this->evaluateAlignments(cost, alignments, true, true);
+			this->evaluateAlignments(cost, alignments, true);
 		}
 		else {
 			cost.alignments = cost.alignments_actual_value = 0.0;
@@ -1388,10 +1987,16 @@ FloorPlanner::Cost FloorPlanner::evaluateLayout(vector<CorblivarAlignmentReq> co
 void FloorPlanner::evaluateThermalDistr(Cost& cost, bool const& set_max_cost) {
 	ThermalAnalyzer::Temp temp;
 
-	// generate power maps based on layout and blocks' power densities
+	// generate power maps based on layout and blocks' power densities; note that
+	// only the bins covered by changed blocks or TSVs are determined again, once
+	// the TSVs are considered as well
 	this->thermalAnalyzer.generatePowerMaps(this->IC.layers, this->blocks,
 			this->getOutline(), this->power_blurring_parameters);
 
+	// the nets' bounding boxes are required for TSVs' impact; they are shared w/
+	// the interconnects evaluation, i.e., only outdated nets are re-evaluated
+	this->evaluateDirtyNets();
+
 	// adapt power maps to account for TSVs' impact
 	this->thermalAnalyzer.adaptPowerMaps(this->IC.layers, this->TSVs, this->nets, this->IC.TSV_pitch, this->power_blurring_parameters);
 
@@ -1431,19 +2036,12 @@ void FloorPlanner::evaluateAreaOutline(FloorPlanner::Cost& cost, double const& f
 	dies_area.reserve(this->IC.layers);
 
 	layout_fits_in_fixed_outline = true;
-	// determine outline and area
+	// determine outline and area; the outline of blocks on all dies is
+	// provided by the layout generation, see generateLayout
 	for (i = 0; i < this->IC.layers; i++) {
 
-		// determine outline for blocks on all dies separately
-		max_outline_x = max_outline_y = 0.0;
-		for (Block const& block : this->blocks) {
-
-			if (block.layer == i) {
-				// update max outline coords
-				max_outline_x = max(max_outline_x, block.bb.ur.x);
-				max_outline_y = max(max_outline_y, block.bb.ur.y);
-			}
-		}
+		max_outline_x = this->dies_outline[i].x;
+		max_outline_y = this->dies_outline[i].y;
 
 		// area, represented by blocks' outline; normalized to die area
 		dies_area.push_back((max_outline_x * max_outline_y) / (this->IC.die_area));
@@ -1495,10 +2093,9 @@ void FloorPlanner::evaluateAreaOutline(FloorPlanner::Cost& cost, double const& f
 
 // TODO apply TSV clustering here; put TSVs into FloorPlanner's list
 void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, bool const& set_max_cost) {
-	int i;
-	vector<Rect const*> blocks_to_consider;
-	Rect bb;
-	double prev_TSVs;
+	long long HPWL_check;
+	int TSVs_check;
+	unsigned b;
 
 	if (FloorPlanner::DBG_CALLS_SA) {
 		cout << "-> FloorPlanner::evaluateInterconnects(" << set_max_cost << ")" << endl;
@@ -1508,78 +2105,82 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, bool const& s
 	cost.TSVs = cost.TSVs_actual_value = 0;
 	cost.TSVs_area_deadspace_ratio = 0.0;
 
-	blocks_to_consider.reserve(this->blocks.size());
+	// re-evaluate nets w/ blocks of changed geometry or layer
+	this->evaluateDirtyNets();
 
-	// determine HPWL and TSVs for each net
-	for (Net& cur_net : this->nets) {
+	cost.HPWL = this->interconnects_cache.HPWL * FloorPlanner::SA_COST_INTERCONNECTS_HPWL_RESOLUTION;
+	cost.TSVs = this->interconnects_cache.TSVs;
 
-		// set layer boundaries, i.e., determine lowest and uppermost layer of
-		// net's blocks
-		cur_net.setLayerBoundaries();
+	// dbg: cross-check w/ full evaluation of all nets; the reference is derived
+	// from the blocks themselves, i.e., from a separate geometry store and netlist
+	// updated for all blocks, thus any changes of blocks missed by the geometry
+	// store or the netlist are revealed
+	if (FloorPlanner::DBG_INTERCONNECTS) {
 
-		if (Net::DBG) {
-			cout << "DBG_NET> Determine interconnects for net " << cur_net.id << endl;
-		}
+		BlocksGeometry geometry_check;
+		Netlist netlist_check = this->netlist;
 
-		// trivial HPWL estimation, considering one global bounding box; required
-		// to compare w/ other 3D floorplanning tools
-		if (FloorPlanner::SA_COST_INTERCONNECTS_TRIVIAL_HPWL) {
+		geometry_check.update(this->blocks);
 
-			// resets blocks to be considered for each cur_net
-			blocks_to_consider.clear();
+		for (Block const& block : this->blocks) {
 
-			// blocks for cur_net on all layer
-			for (Block const* b : cur_net.blocks) {
-				blocks_to_consider.push_back(&b->bb);
+			unsigned const b = block.numerical_id;
+
+			if (this->geometry.layer[b] != block.layer ||
+					this->geometry.ll_x[b] != block.bb.ll.x || this->geometry.ll_y[b] != block.bb.ll.y ||
+					this->geometry.ur_x[b] != block.bb.ur.x || this->geometry.ur_y[b] != block.bb.ur.y) {
+				cout << "DBG_INTERCONNECTS> Outdated geometry store for block " << block.id << ";";
+				cout << " layer: " << this->geometry.layer[b] << " (block: " << block.layer << ")";
+				cout << ", ll: " << this->geometry.ll_x[b] << "," << this->geometry.ll_y[b];
+				cout << " (block: " << block.bb.ll.x << "," << block.bb.ll.y << ")";
+				cout << ", ur: " << this->geometry.ur_x[b] << "," << this->geometry.ur_y[b];
+				cout << " (block: " << block.bb.ur.x << "," << block.bb.ur.y << ")" << endl;
 			}
+		}
 
-			// also consider routes to terminal pins
-			for (Pin const* pin :  cur_net.terminals) {
-				blocks_to_consider.push_back(&pin->bb);
-			}
+		HPWL_check = 0;
+		TSVs_check = 0;
 
-			// determine HPWL of related blocks using their bounding box;
-			// consider center points of blocks instead their whole outline
-			bb = Rect::determBoundingBox(blocks_to_consider, true);
-			cost.HPWL += bb.w;
-			cost.HPWL += bb.h;
+		for (Net const& cur_net : this->nets) {
 
-			if (Net::DBG) {
-				cout << "DBG_NET> 		HPWL of bounding box of blocks to consider: " << (bb.w + bb. h) << endl;
-			}
-		}
-		// more detailed estimate; consider HPWL on each layer separately using
-		// layer-related bounding boxes
-		else {
-			// determine HPWL on each related layer separately
-			for (i = 0; i <= cur_net.layer_top; i++) {
+			Net net_check = cur_net;
+
+			netlist_check.updateBlocksGeometry(cur_net.id, geometry_check);
 
-				// determine HPWL using the net's bounding box on the
-				// current layer
-				bb = cur_net.determBoundingBox(i);
-				cost.HPWL += bb.w;
-				cost.HPWL += bb.h;
+			// the netlist holds another copy of the blocks' geometry and
+			// layer, updated only for nets re-evaluated; compare directly
+			for (b = this->netlist.blocksBegin(cur_net.id); b < this->netlist.blocksEnd(cur_net.id); b++) {
 
-				if (Net::DBG) {
-					cout << "DBG_NET> 		HPWL of bounding box of blocks (in current and possibly upper layers) to consider: " << (bb.w + bb. h) << endl;
+				if (this->netlist.blocks_layer[b] != netlist_check.blocks_layer[b] ||
+						this->netlist.blocks_ll_x[b] != netlist_check.blocks_ll_x[b] ||
+						this->netlist.blocks_ll_y[b] != netlist_check.blocks_ll_y[b] ||
+						this->netlist.blocks_ur_x[b] != netlist_check.blocks_ur_x[b] ||
+						this->netlist.blocks_ur_y[b] != netlist_check.blocks_ur_y[b]) {
+					cout << "DBG_INTERCONNECTS> Outdated netlist entry for block " << this->blocks[this->netlist.blocks[b]].id;
+					cout << " in net " << cur_net.id << ";";
+					cout << " layer: " << this->netlist.blocks_layer[b] << " (block: " << netlist_check.blocks_layer[b] << ")";
+					cout << ", ll: " << this->netlist.blocks_ll_x[b] << "," << this->netlist.blocks_ll_y[b];
+					cout << " (block: " << netlist_check.blocks_ll_x[b] << "," << netlist_check.blocks_ll_y[b] << ")";
+					cout << ", ur: " << this->netlist.blocks_ur_x[b] << "," << this->netlist.blocks_ur_y[b];
+					cout << " (block: " << netlist_check.blocks_ur_x[b] << "," << netlist_check.blocks_ur_y[b] << ")" << endl;
 				}
 			}
-		}
+			this->evaluateNet(net_check, netlist_check, geometry_check);
 
-		if (Net::DBG) {
-			prev_TSVs = cost.TSVs;
-		}
+			HPWL_check += FloorPlanner::fixedHPWL(net_check.HPWL);
+			TSVs_check += net_check.TSVs;
 
-		// determine TSV count
-		cost.TSVs += cur_net.layer_top - cur_net.layer_bottom;
-		// also consider that terminal pins require TSV connections to the
-		// lowermost die
-		if (!cur_net.terminals.empty()) {
-			cost.TSVs += cur_net.layer_bottom;
+			if (net_check.HPWL != cur_net.HPWL || net_check.TSVs != cur_net.TSVs) {
+				cout << "DBG_INTERCONNECTS> Outdated net " << cur_net.id << ";";
+				cout << " HPWL: " << cur_net.HPWL << " (full: " << net_check.HPWL << ")";
+				cout << ", TSVs: " << cur_net.TSVs << " (full: " << net_check.TSVs << ")" << endl;
+			}
 		}
 
-		if (Net::DBG) {
-			cout << "DBG_NET>  TSVs required: " << cost.TSVs - prev_TSVs << endl;
+		if (HPWL_check != this->interconnects_cache.HPWL || TSVs_check != cost.TSVs) {
+			cout << "DBG_INTERCONNECTS> Mismatch w/ full evaluation;";
+			cout << " HPWL: " << cost.HPWL << " (full: " << HPWL_check * FloorPlanner::SA_COST_INTERCONNECTS_HPWL_RESOLUTION << ")";
+			cout << ", TSVs: " << cost.TSVs << " (full: " << TSVs_check << ")" << endl;
 		}
 	}
 
@@ -1614,439 +2215,846 @@ void FloorPlanner::evaluateInterconnects(FloorPlanner::Cost& cost, bool const& s
 	}
 }
 
-// costs are derived from spatial mismatch b/w blocks' alignment and intended alignment;
-// note that this function also marks requests as failed or successful
-void FloorPlanner::evaluateAlignments(Cost& cost, vector<CorblivarAlignmentReq> const& alignments, bool const& derive_TSVs, bool const& set_max_cost) {
-	Rect blocks_intersect;
-	Rect blocks_bb;
-	double TSVs_row_col;
+// re-evaluate HPWL, TSVs and bounding boxes of nets w/ blocks of changed geometry or
+// layer; the nets' cached values are thus shared by the interconnects and the thermal
+// evaluation, i.e., they are determined only once for each layout
+void FloorPlanner::evaluateDirtyNets() {
+	unsigned d;
+	vector<unsigned> const& dirty_nets = this->interconnects_cache.dirty_nets;
 
-	if (FloorPlanner::DBG_CALLS_SA) {
-		cout << "-> FloorPlanner::evaluateAlignments(" << &cost << ", " << &alignments << ", " << derive_TSVs << ", " << set_max_cost << ")" << endl;
+	// determine nets to be re-evaluated
+	this->determDirtyNets();
+
+	// memorize previous values of such nets
+	this->interconnects_cache.dirty_nets_HPWL.clear();
+	this->interconnects_cache.dirty_nets_TSVs.clear();
+	for (unsigned const& n : dirty_nets) {
+		this->interconnects_cache.dirty_nets_HPWL.push_back(this->nets[n].HPWL);
+		this->interconnects_cache.dirty_nets_TSVs.push_back(this->nets[n].TSVs);
 	}
 
-	cost.alignments = cost.alignments_actual_value = 0.0;
+	// re-evaluate only such nets; each net is handled by one thread, and
+	// evaluating a net only modifies the net itself and its range w/in the
+	// netlist, thus nets can be evaluated concurrently w/o any locking
+	this->determDirtyNetsChunks();
 
-	// evaluate all alignment requests
-	for (CorblivarAlignmentReq const& req : alignments) {
+	function<void(unsigned const&)> evaluateChunk = [this, &dirty_nets](unsigned const& chunk) {
 
-		// initially, assume the request to be feasible
-		req.fulfilled = true;
-		// also assume alignment status of blocks themselves to be successful
-		req.s_i->alignment = Block::AlignmentStatus::SUCCESS;
-		req.s_j->alignment = Block::AlignmentStatus::SUCCESS;
+		for (unsigned d = this->interconnects_cache.dirty_nets_chunks[chunk]; d < this->interconnects_cache.dirty_nets_chunks[chunk + 1]; d++) {
 
-		// for request w/ alignment ranges, we verify the alignment via the
-		// blocks' intersection
-		if (req.range_x() || req.range_y()) {
-			blocks_intersect = Rect::determineIntersection(req.s_i->bb, req.s_j->bb);
-		}
-		// for requests w/ max distance ranges, we verify the alignment via the
-		// blocks' bounding box (considering the blocks' center points)
-		if (req.range_max_x() || req.range_max_y()) {
-			blocks_bb = Rect::determBoundingBox(req.s_i->bb, req.s_j->bb, true);
+			// update net's blocks in netlist, then re-evaluate
+			this->netlist.updateBlocksGeometry(dirty_nets[d], this->geometry);
+			this->evaluateNet(this->nets[dirty_nets[d]], this->netlist, this->geometry);
 		}
+	};
 
-		// check partial request, horizontal alignment
-		//
-		// alignment range
-		if (req.range_x()) {
+	if (this->interconnects_cache.dirty_nets_chunks.size() > 2) {
+		this->thread_pool->run(this->interconnects_cache.dirty_nets_chunks.size() - 1, evaluateChunk);
+	}
+	else if (!dirty_nets.empty()) {
+		evaluateChunk(0);
+	}
 
-			// consider the spatial mismatch as cost; overlap too small
-			if (blocks_intersect.w < req.alignment_x) {
+	// accumulate cost deltas; the HPWL is accumulated in fixed point, thus the
+	// accumulated value is exact, i.e., it does not drift over many updates and
+	// it is independent of the order of nets and their concurrent evaluation
+	for (d = 0; d < dirty_nets.size(); d++) {
 
-				// missing overlap
-				cost.alignments += req.alignment_x - blocks_intersect.w;
+		Net const& cur_net = this->nets[dirty_nets[d]];
 
-				// in case blocks don't overlap at all, also consider the
-				// blocks' distance as further cost
-				if (blocks_intersect.w == 0) {
+		this->interconnects_cache.HPWL -= FloorPlanner::fixedHPWL(this->interconnects_cache.dirty_nets_HPWL[d]);
+		this->interconnects_cache.TSVs -= this->interconnects_cache.dirty_nets_TSVs[d];
 
-					if (Rect::rectA_leftOf_rectB(req.s_i->bb, req.s_j->bb, false)) {
+		this->interconnects_cache.HPWL += FloorPlanner::fixedHPWL(cur_net.HPWL);
+		this->interconnects_cache.TSVs += cur_net.TSVs;
 
-						cost.alignments += req.s_j->bb.ll.x - req.s_i->bb.ur.x;
+		this->interconnects_cache.nets_dirty[dirty_nets[d]] = false;
+	}
+	this->interconnects_cache.dirty_nets.clear();
+}
 
-						// annotate block-alignment failure
-						req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-						req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-					}
-					else {
+// determine chunks of nets to be re-evaluated; chunks are balanced regarding the
+// nets' blocks and pins, i.e., the effort for evaluating them. Only one chunk is
+// considered w/o thread pool or for few nets
+void FloorPlanner::determDirtyNetsChunks() {
+	unsigned d, n;
+	unsigned chunks;
+	unsigned pins, pins_chunk;
 
-						cost.alignments += req.s_i->bb.ll.x - req.s_j->bb.ur.x;
+	vector<unsigned>& dirty_nets_chunks = this->interconnects_cache.dirty_nets_chunks;
 
-						// annotate block-alignment failure
-						req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-						req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-					}
+	dirty_nets_chunks.clear();
+	dirty_nets_chunks.push_back(0);
+
+	// determine overall count of blocks and pins
+	pins = 0;
+	for (unsigned const& net : this->interconnects_cache.dirty_nets) {
+		pins += this->netlist.blocksEnd(net) - this->netlist.blocksBegin(net);
+		pins += this->netlist.terminalsEnd(net) - this->netlist.terminalsBegin(net);
+	}
+
+	if (this->thread_pool == nullptr || pins < FloorPlanner::SA_COST_INTERCONNECTS_CONCURRENT_MIN_PINS) {
+		chunks = 1;
+	}
+	else {
+		chunks = this->thread_pool->threads() * FloorPlanner::SA_COST_INTERCONNECTS_CONCURRENT_CHUNKS;
+	}
+
+	// assign nets to chunks, until the chunk's share of pins is reached
+	pins_chunk = 0;
+	n = 1;
+	for (d = 0; d < this->interconnects_cache.dirty_nets.size() && n < chunks; d++) {
+
+		unsigned const& net = this->interconnects_cache.dirty_nets[d];
+
+		pins_chunk += this->netlist.blocksEnd(net) - this->netlist.blocksBegin(net);
+		pins_chunk += this->netlist.terminalsEnd(net) - this->netlist.terminalsBegin(net);
+
+		if (static_cast<unsigned long>(pins_chunk) * chunks >= static_cast<unsigned long>(pins) * n) {
+			dirty_nets_chunks.push_back(d + 1);
+			n++;
+		}
+	}
+	if (dirty_nets_chunks.back() != this->interconnects_cache.dirty_nets.size()) {
+		dirty_nets_chunks.push_back(this->interconnects_cache.dirty_nets.size());
+	}
+}
+
+// determine nets to be re-evaluated; nets are considered for re-evaluation if any of
+// their blocks changed its geometry or layer since the previous evaluation
+void FloorPlanner::determDirtyNets() {
+	unsigned b, n;
+
+	// invalid cache; (re-)init cache and consider all nets
+	if (!this->interconnects_cache.valid) {
+
+		// init nets of each block, once
+		if (this->interconnects_cache.blocks_nets.empty()) {
+
+			this->interconnects_cache.blocks_nets.resize(this->blocks.size());
+
+			for (n = 0; n < this->netlist.size(); n++) {
+				for (b = this->netlist.blocksBegin(n); b < this->netlist.blocksEnd(n); b++) {
+					this->interconnects_cache.blocks_nets[this->netlist.blocks[b]].push_back(n);
 				}
+			}
+		}
+
+		// all nets are considered, thus previous changes are not relevant
+		this->geometry.clearChanged();
+
+		// reset accumulated values and consider all nets
+		this->interconnects_cache.HPWL = 0;
+		this->interconnects_cache.TSVs = 0;
+		this->interconnects_cache.nets_dirty.assign(this->nets.size(), true);
+		this->interconnects_cache.dirty_nets.clear();
+
+		for (n = 0; n < this->nets.size(); n++) {
+			this->nets[n].HPWL = 0.0;
+			this->nets[n].TSVs = 0;
 
-				// annotate general alignment failure
-				req.fulfilled = false;
+			this->interconnects_cache.dirty_nets.push_back(n);
+		}
+
+		this->interconnects_cache.valid = true;
+
+		return;
+	}
+
+	// regular case; consider only blocks w/ changed geometry or layer, as
+	// memorized by the geometry store during layout generation
+	for (unsigned const& block : this->geometry.changed) {
+
+		// mark related nets
+		for (unsigned const& net : this->interconnects_cache.blocks_nets[block]) {
+
+			if (!this->interconnects_cache.nets_dirty[net]) {
+				this->interconnects_cache.nets_dirty[net] = true;
+				this->interconnects_cache.dirty_nets.push_back(net);
 			}
 		}
-		// max distance range
-		else if (req.range_max_x()) {
+	}
+	this->geometry.clearChanged();
+}
 
-			// consider the spatial mismatch as cost; distance too large
-			if (blocks_bb.w > req.alignment_x) {
+// determine HPWL and TSVs of one net, w/ the net's blocks as given by the netlist and
+// the geometry store; values are stored in net itself
+void FloorPlanner::evaluateNet(Net& net, Netlist const& netlist, BlocksGeometry const& geometry) const {
+	int i;
+	unsigned b, t;
+	Rect bb;
 
-				cost.alignments += blocks_bb.w - req.alignment_x;
+	if (Net::DBG) {
+		cout << "DBG_NET> Determine interconnects for net " << net.id << endl;
+	}
 
-				// annotate general alignment failure
-				req.fulfilled = false;
+	// determine lowest and uppermost layer of net's blocks, along w/ the bounding
+	// boxes on each layer; the latter are also required for the thermal analysis,
+	// thus they are always determined
+	net.determBoundingBoxes(netlist, this->IC.layers);
 
-				// annotate block-alignment failure
-				if (req.s_i->bb.ll.x < req.s_j->bb.ll.x) {
-					req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-					req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-				}
-				else {
-					req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-					req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-				}
+	net.HPWL = 0.0;
+
+	// trivial HPWL estimation, considering one global bounding box; required to
+	// compare w/ other 3D floorplanning tools
+	if (FloorPlanner::SA_COST_INTERCONNECTS_TRIVIAL_HPWL) {
+
+		// determine HPWL of related blocks using their bounding box; consider
+		// center points of blocks instead their whole outline
+		bb.ll.x = bb.ll.y = numeric_limits<double>::max();
+		bb.ur.x = bb.ur.y = numeric_limits<double>::lowest();
+
+		// blocks for net on all layer
+		for (b = netlist.blocksBegin(net.id); b < netlist.blocksEnd(net.id); b++) {
+
+			unsigned const& block = netlist.blocks[b];
+			double const center_x = geometry.ll_x[block] + geometry.w[block] / 2.0;
+			double const center_y = geometry.ll_y[block] + geometry.h[block] / 2.0;
+
+			Net::extendBoundingBox(bb, center_x, center_y, center_x, center_y);
+		}
+
+		// also consider routes to terminal pins
+		for (t = netlist.terminalsBegin(net.id); t < netlist.terminalsEnd(net.id); t++) {
+
+			Pin const* pin = netlist.terminals[t];
+			double const center_x = pin->bb.ll.x + pin->bb.w / 2.0;
+			double const center_y = pin->bb.ll.y + pin->bb.h / 2.0;
+
+			Net::extendBoundingBox(bb, center_x, center_y, center_x, center_y);
+		}
+
+		// ignore nets w/o any blocks and pins
+		if (bb.ll.x <= bb.ur.x) {
+			bb.w = bb.ur.x - bb.ll.x;
+			bb.h = bb.ur.y - bb.ll.y;
+		}
+		net.HPWL += bb.w;
+		net.HPWL += bb.h;
+
+		if (Net::DBG) {
+			cout << "DBG_NET> 		HPWL of bounding box of blocks to consider: " << (bb.w + bb. h) << endl;
+		}
+	}
+	// more detailed estimate; consider HPWL on each layer separately using
+	// layer-related bounding boxes
+	else {
+		// determine HPWL on each related layer separately
+		for (i = 0; i <= net.layer_top; i++) {
+
+			// determine HPWL using the net's bounding box on the current
+			// layer
+			Rect const& bb = net.bb[i];
+			net.HPWL += bb.w;
+			net.HPWL += bb.h;
+
+			if (Net::DBG) {
+				cout << "DBG_NET> 		HPWL of bounding box of blocks (in current and possibly upper layers) to consider: " << (bb.w + bb. h) << endl;
 			}
 		}
-		// fixed alignment offset
-		else if (req.offset_x()) {
+	}
+
+	// determine TSV count
+	net.TSVs = net.layer_top - net.layer_bottom;
+	// also consider that terminal pins require TSV connections to the lowermost die
+	if (netlist.hasTerminals(net.id)) {
+		net.TSVs += net.layer_bottom;
+	}
 
-			// check the blocks' offset against the required offset
-			if (!Math::doubleComp(req.s_j->bb.ll.x - req.s_i->bb.ll.x, req.alignment_x)) {
+	if (Net::DBG) {
+		cout << "DBG_NET>  TSVs required: " << net.TSVs << endl;
+	}
+}
 
-				// s_j should be to the right of s_i;
-				// consider the spatial mismatch as cost
-				if (req.alignment_x >= 0.0) {
+// costs are derived from spatial mismatch b/w blocks' alignment and intended alignment;
+// note that this function also marks requests as failed or successful and derives
+// TSVs for vertical buses of fulfilled requests. Only requests w/ blocks of changed
+// geometry or layer are re-evaluated, see determDirtyAlignments
+void FloorPlanner::evaluateAlignments(Cost& cost, vector<CorblivarAlignmentReq> const& alignments, bool const& set_max_cost) {
 
-					// s_j is to the right of s_i
-					if (req.s_j->bb.ll.x > req.s_i->bb.ll.x) {
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "-> FloorPlanner::evaluateAlignments(" << &cost << ", " << &alignments << ", " << set_max_cost << ")" << endl;
+	}
 
-						// abs required for cases where s_j is too
-						// far left, i.e., not sufficiently away
-						// from s_i
-						cost.alignments += abs(req.s_j->bb.ll.x - req.s_i->bb.ll.x - req.alignment_x);
+	cost.alignments = cost.alignments_actual_value = 0.0;
 
-						// annotate block-alignment failure;
-						// s_j is too far left, s_i too far right
-						if ((req.s_j->bb.ll.x - req.s_i->bb.ll.x - req.alignment_x) < 0) {
-							req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-							req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-						}
-						// s_j is too far right, s_i too far left
-						else {
-							req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-							req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-						}
-					}
-					// s_j is to the left of s_i
-					else {
-						// cost includes distance b/w (right) s_i,
-						// (left) s_j and the failed offset
-						cost.alignments += req.s_i->bb.ll.x - req.s_j->bb.ll.x + req.alignment_x;
+	// determine requests to be re-evaluated, i.e., requests w/ blocks of changed
+	// geometry or layer
+	this->determDirtyAlignments(alignments);
 
-						// annotate block-alignment failure
-						req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-						req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-					}
-				}
-				// s_j should be to the left of s_i;
-				// consider the spatial mismatch as cost
-				else {
+	// re-evaluate only such requests; annotate requests and blocks
+	for (unsigned const& r : this->alignments_cache.dirty_reqs) {
 
-					// s_j is to the left of s_i
-					if (req.s_j->bb.ll.x < req.s_i->bb.ll.x) {
+		CorblivarAlignmentReq const& req = alignments[r];
+		AlignmentEval& eval = this->alignments_cache.reqs[r];
 
-						// abs required for cases where s_j is too
-						// far right, i.e., not sufficiently away
-						// from s_i
-						cost.alignments += abs(req.s_i->bb.ll.x - req.s_j->bb.ll.x + req.alignment_x);
+		this->evaluateAlignment(req, eval);
 
-						// annotate block-alignment failure;
-						// s_j is too far right, s_i too far left
-						if ((req.s_i->bb.ll.x - req.s_j->bb.ll.x + req.alignment_x) < 0) {
-							req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-							req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-						}
-						// s_j is too far left, s_i too far right
-						else {
-							req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-							req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-						}
-					}
-					// s_j is right of s_i
-					else {
-						// cost includes distance b/w (left) s_i,
-						// (right) s_j and the failed (negative) offset
-						cost.alignments += req.s_j->bb.ll.x - req.s_i->bb.ll.x - req.alignment_x;
+		req.fulfilled = eval.fulfilled;
 
-						// annotate block-alignment failure
-						req.s_i->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
-						req.s_j->alignment = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
-					}
+		// the alignment status of blocks involved in multiple requests is
+		// defined by their last request
+		if (req.s_i->numerical_id >= 0 && this->alignments_cache.blocks_last_req[this->alignments_cache.blocks_index[req.s_i->numerical_id]] == r) {
+			req.s_i->alignment = eval.s_i;
+		}
+		if (req.s_j->numerical_id >= 0 && this->alignments_cache.blocks_last_req[this->alignments_cache.blocks_index[req.s_j->numerical_id]] == r) {
+			req.s_j->alignment = eval.s_j;
+		}
+
+		// derive TSVs for vertical bus of request
+		this->determVerticalBus(req, r);
+
+		this->alignments_cache.reqs_dirty[r] = false;
+	}
+	this->alignments_cache.dirty_reqs.clear();
+
+	// accumulate cost of all requests, in order of requests and their terms
+	for (AlignmentEval const& eval : this->alignments_cache.reqs) {
+		for (unsigned c = 0; c < eval.cost_terms; c++) {
+			cost.alignments += eval.cost[c];
+		}
+	}
+
+	// dbg logging for alignment
+	if (FloorPlanner::DBG_ALIGNMENT) {
+
+		for (CorblivarAlignmentReq const& req : alignments) {
+
+			cout << "DBG_ALIGNMENT> " << req.tupleString() << endl;
+
+			if (req.fulfilled) {
+				cout << "DBG_ALIGNMENT>  Success" << endl;
+			}
+			else {
+				cout << "DBG_ALIGNMENT>  Failure" << endl;
+				cout << "DBG_ALIGNMENT>   block " << req.s_i->id << ": " << req.s_i->alignment << endl;
+				cout << "DBG_ALIGNMENT>   block " << req.s_j->id << ": " << req.s_j->alignment << endl;
+			}
+		}
+	}
+
+	// memorize max cost; initial sampling
+	if (set_max_cost) {
+		this->max_cost_alignments = cost.alignments;
+	}
+
+	// store actual value
+	cost.alignments_actual_value = cost.alignments;
+	// normalize value; refers to max value from initial sampling
+	cost.alignments /= this->max_cost_alignments;
+
+	if (FloorPlanner::DBG_CALLS_SA) {
+		cout << "<- FloorPlanner::evaluateAlignments : " << cost.alignments << endl;
+	}
+}
+
+// determine alignment requests to be re-evaluated; requests are considered for
+// re-evaluation if any of their blocks changed its geometry or layer since the previous
+// evaluation
+void FloorPlanner::determDirtyAlignments(vector<CorblivarAlignmentReq> const& alignments) {
+	unsigned b, r;
+
+	// invalid cache or other set of requests; (re-)init cache and consider all
+	// requests
+	if (!this->alignments_cache.valid || this->alignments_cache.alignments != &alignments ||
+			this->alignments_cache.reqs.size() != alignments.size()) {
+
+		this->alignments_cache.alignments = &alignments;
+
+		// init blocks of requests, their requests and their last request
+		this->alignments_cache.blocks.clear();
+		this->alignments_cache.blocks_index.assign(this->blocks.size(), -1);
+		this->alignments_cache.blocks_reqs.clear();
+		this->alignments_cache.blocks_last_req.clear();
+
+		for (r = 0; r < alignments.size(); r++) {
+			for (Block const* block : {alignments[r].s_i, alignments[r].s_j}) {
+
+				// ignore the dummy reference block; its geometry is fixed
+				if (block->numerical_id < 0) {
+					continue;
 				}
 
-				// annotate general alignment failure
-				req.fulfilled = false;
+				if (this->alignments_cache.blocks_index[block->numerical_id] == -1) {
+
+					this->alignments_cache.blocks_index[block->numerical_id] = this->alignments_cache.blocks.size();
+					this->alignments_cache.blocks.push_back(block);
+					this->alignments_cache.blocks_reqs.emplace_back();
+					this->alignments_cache.blocks_last_req.push_back(r);
+				}
+
+				b = this->alignments_cache.blocks_index[block->numerical_id];
+
+				this->alignments_cache.blocks_reqs[b].push_back(r);
+				this->alignments_cache.blocks_last_req[b] = r;
 			}
 		}
 
-		// check partial request, vertical alignment
-		//
-		// alignment range
-		if (req.range_y()) {
+		// memorize blocks' current geometry and layer
+		this->alignments_cache.blocks_bb.clear();
+		this->alignments_cache.blocks_layer.clear();
+		for (Block const* block : this->alignments_cache.blocks) {
+			this->alignments_cache.blocks_bb.push_back(block->bb);
+			this->alignments_cache.blocks_layer.push_back(block->layer);
+		}
+
+		// init table of TSV groups for vertical buses; one group for each
+		// request and each layer (but the uppermost), i.e., for all possible
+		// bus segments; the groups' ids depend only on the request and are
+		// thus defined only once
+		this->TSVs.clear();
+		this->TSVs.reserve(alignments.size() * max(0, this->IC.layers - 1));
+		for (CorblivarAlignmentReq const& req : alignments) {
+			for (int layer = 0; layer < this->IC.layers - 1; layer++) {
+				this->TSVs.emplace_back("bus_" + req.s_i->id + "_" + req.s_j->id, req.signals, layer);
+			}
+		}
 
-			// consider the spatial mismatch as cost; overlap too small
-			if (blocks_intersect.h < req.alignment_y) {
+		// consider all requests
+		this->alignments_cache.reqs.assign(alignments.size(), AlignmentEval());
+		this->alignments_cache.reqs_dirty.assign(alignments.size(), true);
+		this->alignments_cache.dirty_reqs.clear();
+		for (r = 0; r < alignments.size(); r++) {
+			this->alignments_cache.dirty_reqs.push_back(r);
+		}
 
-				// missing overlap
-				cost.alignments += req.alignment_y - blocks_intersect.h;
+		this->alignments_cache.valid = true;
 
-				// in case blocks don't overlap at all, also consider the
-				// blocks' distance as further cost
-				if (blocks_intersect.h == 0) {
+		return;
+	}
 
-					if (Rect::rectA_below_rectB(req.s_i->bb, req.s_j->bb, false)) {
+	// regular case; compare blocks' current geometry and layer w/ previous ones
+	for (b = 0; b < this->alignments_cache.blocks.size(); b++) {
 
-						cost.alignments += req.s_j->bb.ll.y - req.s_i->bb.ur.y;
+		Block const* block = this->alignments_cache.blocks[b];
+		Rect& bb = this->alignments_cache.blocks_bb[b];
 
-						// annotate block-alignment failure
-						req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
-						req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
-					}
-					else {
+		if (block->layer == this->alignments_cache.blocks_layer[b] &&
+				block->bb.ll.x == bb.ll.x && block->bb.ll.y == bb.ll.y &&
+				block->bb.ur.x == bb.ur.x && block->bb.ur.y == bb.ur.y) {
+			continue;
+		}
 
-						cost.alignments += req.s_i->bb.ll.y - req.s_j->bb.ur.y;
+		// memorize changed geometry and layer
+		bb = block->bb;
+		this->alignments_cache.blocks_layer[b] = block->layer;
 
-						// annotate block-alignment failure
-						req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
-						req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
-					}
+		// mark related requests
+		for (unsigned const& req : this->alignments_cache.blocks_reqs[b]) {
+
+			if (!this->alignments_cache.reqs_dirty[req]) {
+				this->alignments_cache.reqs_dirty[req] = true;
+				this->alignments_cache.dirty_reqs.push_back(req);
+			}
+		}
+	}
+}
+
+// derive TSVs for vertical bus of alignment request; the related groups of TSVs are
+// preallocated for each request and each layer, i.e., the groups are only updated here
+void FloorPlanner::determVerticalBus(CorblivarAlignmentReq const& req, unsigned const& r) {
+	Rect blocks_intersect;
+	double TSVs_row_col;
+
+	// reset groups of request; groups are only used for fulfilled requests and
+	// for layers spanned by the request's blocks
+	for (int layer = 0; layer < this->IC.layers - 1; layer++) {
+		this->TSVs[r * (this->IC.layers - 1) + layer].active = false;
+	}
+
+	// only consider fulfilled alignments
+	if (req.fulfilled) {
+
+		// consider valid block intersections independent of defined
+		// alignment; this way, all vertical buses arising from different
+		// alignment requests will be considered 
+		blocks_intersect = Rect::determineIntersection(req.s_i->bb, req.s_j->bb);
+		if (blocks_intersect.area != 0.0) {
+
+			// consider TSVs in all affected layers
+			for (int layer = min(req.s_i->layer, req.s_j->layer); layer < max(req.s_i->layer, req.s_j->layer); layer++) {
+
+				// bus segment for layer, from table of groups
+				TSV_Group& vert_bus = this->TSVs[r * (this->IC.layers - 1) + layer];
+				vert_bus.active = true;
+
+				// define bus outline; consider required area for
+				// given amount of TSVs
+				//
+				// note that the following code does _not_consider
+				// a sanity check where the required area for TSVs
+				// is larger than the intersection; since TSVs are
+				// assumed to be embedded into blocks later on
+				// anyway, such over-usage of block area is not
+				// critical
+
+				// init TSV group with actual intersection; this
+				// way, the lower-left corners of the TSV group
+				// and the actual intersection match
+				vert_bus.bb = blocks_intersect;
+
+				// minimal side of TSV-group rectangle is
+				// intersection's width
+				if (blocks_intersect.w < blocks_intersect.h) {
+
+					// determine maximal amount of TSVs to be
+					// put in smaller side of TSV-group
+					// rectangle
+					TSVs_row_col = floor(blocks_intersect.w / this->IC.TSV_pitch);
+
+					// define smaller side of actual TSV-group
+					// rectangle
+					vert_bus.bb.w = TSVs_row_col * this->IC.TSV_pitch;
+					vert_bus.bb.ur.x = vert_bus.bb.ll.x + vert_bus.bb.w;
+
+					// define larger side of actual TSV-group
+					// rectangle; ceil accounts for additional
+					// row of TSVs if they are not completely
+					// fitting, i.e., not filling a rectangle
+					vert_bus.bb.h = ceil(vert_bus.TSVs_count / TSVs_row_col) * this->IC.TSV_pitch;
+					vert_bus.bb.ur.y = vert_bus.bb.ll.y + vert_bus.bb.h;
 				}
+				// minimal side of TSV-group rectangle is
+				// intersection's height
+				else {
+					// determine maximal amount of TSVs to be
+					// put in smaller side of TSV-group
+					// rectangle
+					TSVs_row_col = floor(blocks_intersect.h / this->IC.TSV_pitch);
+
+					// define smaller side of actual TSV-group
+					// rectangle
+					vert_bus.bb.h = TSVs_row_col * this->IC.TSV_pitch;
+					vert_bus.bb.ur.y = vert_bus.bb.ll.y + vert_bus.bb.h;
+
+					// define larger side of actual TSV-group
+					// rectangle; ceil accounts for additional
+					// column of TSVs if they are not completely
+					// fitting, i.e., not filling a rectangle
+					vert_bus.bb.w = ceil(vert_bus.TSVs_count / TSVs_row_col) * this->IC.TSV_pitch;
+					vert_bus.bb.ur.x = vert_bus.bb.ll.x + vert_bus.bb.w;
+				}
+
+				// dbg logging for TSV generation
+				if (FloorPlanner::DBG_TSVS) {
 
-				// annotate general alignment failure
-				req.fulfilled = false;
+					cout << "DBG_TSVs> TSV group" << endl;
+					cout << "DBG_TSVs>  " << vert_bus.id << endl;
+					cout << "DBG_TSVs>  (" << vert_bus.bb.ll.x << "," << vert_bus.bb.ll.y << ")";
+					cout << "(" << vert_bus.bb.ur.x << "," << vert_bus.bb.ur.y << ")" << endl;
+				}
 			}
 		}
-		// max distance range
-		else if (req.range_max_y()) {
+	}
+}
+
+// evaluate one alignment request; costs are derived from spatial mismatch b/w blocks'
+// alignment and intended alignment. Note that neither the request nor the blocks are
+// annotated here, see evaluateAlignments
+void FloorPlanner::evaluateAlignment(CorblivarAlignmentReq const& req, AlignmentEval& eval) const {
+	Rect blocks_intersect;
+	Rect blocks_bb;
+
+	// initially, assume the request to be feasible
+	eval.fulfilled = true;
+	eval.cost_terms = 0;
+	// also assume alignment status of blocks themselves to be successful
+	eval.s_i = Block::AlignmentStatus::SUCCESS;
+	eval.s_j = Block::AlignmentStatus::SUCCESS;
+
+	// for request w/ alignment ranges, we verify the alignment via the
+	// blocks' intersection
+	if (req.range_x() || req.range_y()) {
+		blocks_intersect = Rect::determineIntersection(req.s_i->bb, req.s_j->bb);
+	}
+	// for requests w/ max distance ranges, we verify the alignment via the
+	// blocks' bounding box (considering the blocks' center points)
+	if (req.range_max_x() || req.range_max_y()) {
+		blocks_bb = Rect::determBoundingBox(req.s_i->bb, req.s_j->bb, true);
+	}
+
+	// check partial request, horizontal alignment
+	//
+	// alignment range
+	if (req.range_x()) {
+
+		// consider the spatial mismatch as cost; overlap too small
+		if (blocks_intersect.w < req.alignment_x) {
+
+			// missing overlap
+			eval.addCost(req.alignment_x - blocks_intersect.w);
 
-			// consider the spatial mismatch as cost; distance too large
-			if (blocks_bb.h > req.alignment_y) {
+			// in case blocks don't overlap at all, also consider the
+			// blocks' distance as further cost
+			if (blocks_intersect.w == 0) {
 
-				cost.alignments += blocks_bb.h - req.alignment_y;
+				if (Rect::rectA_leftOf_rectB(req.s_i->bb, req.s_j->bb, false)) {
 
-				// annotate general alignment failure
-				req.fulfilled = false;
+					eval.addCost(req.s_j->bb.ll.x - req.s_i->bb.ur.x);
 
-				// annotate block-alignment failure
-				if (req.s_i->bb.ll.y < req.s_j->bb.ll.y) {
-					req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
-					req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+					// annotate block-alignment failure
+					eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
+					eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
 				}
 				else {
-					req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
-					req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+
+					eval.addCost(req.s_i->bb.ll.x - req.s_j->bb.ur.x);
+
+					// annotate block-alignment failure
+					eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
+					eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
 				}
 			}
+
+			// annotate general alignment failure
+			eval.fulfilled = false;
 		}
-		// fixed alignment offset
-		else if (req.offset_y()) {
+	}
+	// max distance range
+	else if (req.range_max_x()) {
 
-			// check the blocks' offset against the required offset
-			if (!Math::doubleComp(req.s_j->bb.ll.y - req.s_i->bb.ll.y, req.alignment_y)) {
+		// consider the spatial mismatch as cost; distance too large
+		if (blocks_bb.w > req.alignment_x) {
 
-				// s_j should be above s_i;
-				// consider the spatial mismatch as cost
-				if (req.alignment_y >= 0.0) {
+			eval.addCost(blocks_bb.w - req.alignment_x);
 
-					// s_j is above s_i
-					if (req.s_j->bb.ll.y > req.s_i->bb.ll.y) {
+			// annotate general alignment failure
+			eval.fulfilled = false;
 
-						// abs required for cases where s_j is too
-						// far lowerwards, i.e., not sufficiently
-						// away from s_i
-						cost.alignments += abs(req.s_j->bb.ll.y - req.s_i->bb.ll.y - req.alignment_y);
+			// annotate block-alignment failure
+			if (req.s_i->bb.ll.x < req.s_j->bb.ll.x) {
+				eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
+				eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
+			}
+			else {
+				eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
+				eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
+			}
+		}
+	}
+	// fixed alignment offset
+	else if (req.offset_x()) {
 
-						// annotate block-alignment failure;
-						// s_j is too far lowerwards, s_i too far upwards
-						if ((req.s_j->bb.ll.y - req.s_i->bb.ll.y - req.alignment_y) < 0) {
-							req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
-							req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
-						}
-						// s_j is too far upwards, s_i too far
-						// lowerwards
-						else {
-							req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
-							req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
-						}
+		// check the blocks' offset against the required offset
+		if (!Math::doubleComp(req.s_j->bb.ll.x - req.s_i->bb.ll.x, req.alignment_x)) {
+
+			// s_j should be to the right of s_i;
+			// consider the spatial mismatch as cost
+			if (req.alignment_x >= 0.0) {
+
+				// s_j is to the right of s_i
+				if (req.s_j->bb.ll.x > req.s_i->bb.ll.x) {
+
+					// abs required for cases where s_j is too
+					// far left, i.e., not sufficiently away
+					// from s_i
+					eval.addCost(abs(req.s_j->bb.ll.x - req.s_i->bb.ll.x - req.alignment_x));
+
+					// annotate block-alignment failure;
+					// s_j is too far left, s_i too far right
+					if ((req.s_j->bb.ll.x - req.s_i->bb.ll.x - req.alignment_x) < 0) {
+						eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
+						eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
 					}
-					// s_j is below s_i
+					// s_j is too far right, s_i too far left
 					else {
-						// cost includes distance b/w (upper) s_i,
-						// (lower) s_j and the failed offset
-						cost.alignments += req.s_i->bb.ll.y - req.s_j->bb.ll.y + req.alignment_y;
-
-						// annotate block-alignment failure
-						req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
-						req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+						eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
+						eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
 					}
 				}
-				// s_j should be below s_i;
-				// consider the spatial mismatch as cost
+				// s_j is to the left of s_i
 				else {
+					// cost includes distance b/w (right) s_i,
+					// (left) s_j and the failed offset
+					eval.addCost(req.s_i->bb.ll.x - req.s_j->bb.ll.x + req.alignment_x);
 
-					// s_j is below s_i
-					if (req.s_j->bb.ll.y < req.s_i->bb.ll.y) {
+					// annotate block-alignment failure
+					eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
+					eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
+				}
+			}
+			// s_j should be to the left of s_i;
+			// consider the spatial mismatch as cost
+			else {
 
-						// abs required for cases where s_j is too
-						// far upwards, i.e., not sufficiently
-						// away from s_i
-						cost.alignments += abs(req.s_i->bb.ll.y - req.s_j->bb.ll.y + req.alignment_y);
+				// s_j is to the left of s_i
+				if (req.s_j->bb.ll.x < req.s_i->bb.ll.x) {
 
-						// annotate block-alignment failure;
-						// s_j is too far upwards, s_i too far
-						// lowerwards
-						if ((req.s_i->bb.ll.y - req.s_j->bb.ll.y + req.alignment_y) < 0) {
-							req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
-							req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
-						}
-						// s_j is too far lowerwards, s_i too far
-						// upwards
-						else {
-							req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
-							req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
-						}
+					// abs required for cases where s_j is too
+					// far right, i.e., not sufficiently away
+					// from s_i
+					eval.addCost(abs(req.s_i->bb.ll.x - req.s_j->bb.ll.x + req.alignment_x));
+
+					// annotate block-alignment failure;
+					// s_j is too far right, s_i too far left
+					if ((req.s_i->bb.ll.x - req.s_j->bb.ll.x + req.alignment_x) < 0) {
+						eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
+						eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
 					}
-					// s_j is above s_i
+					// s_j is too far left, s_i too far right
 					else {
-						// cost includes distance b/w (lower) s_i,
-						// (upper) s_j and the failed (negative) offset
-						cost.alignments += req.s_j->bb.ll.y - req.s_i->bb.ll.y - req.alignment_y;
-
-						// annotate block-alignment failure
-						req.s_i->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
-						req.s_j->alignment = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+						eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
+						eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
 					}
 				}
+				// s_j is right of s_i
+				else {
+					// cost includes distance b/w (left) s_i,
+					// (right) s_j and the failed (negative) offset
+					eval.addCost(req.s_j->bb.ll.x - req.s_i->bb.ll.x - req.alignment_x);
 
-				// annotate general alignment failure
-				req.fulfilled = false;
+					// annotate block-alignment failure
+					eval.s_i = Block::AlignmentStatus::FAIL_HOR_TOO_LEFT;
+					eval.s_j = Block::AlignmentStatus::FAIL_HOR_TOO_RIGHT;
+				}
 			}
+
+			// annotate general alignment failure
+			eval.fulfilled = false;
 		}
+	}
+
+	// check partial request, vertical alignment
+	//
+	// alignment range
+	if (req.range_y()) {
 
-		// dbg logging for alignment
-		if (FloorPlanner::DBG_ALIGNMENT) {
+		// consider the spatial mismatch as cost; overlap too small
+		if (blocks_intersect.h < req.alignment_y) {
 
-			cout << "DBG_ALIGNMENT> " << req.tupleString() << endl;
+			// missing overlap
+			eval.addCost(req.alignment_y - blocks_intersect.h);
 
-			if (req.fulfilled) {
-				cout << "DBG_ALIGNMENT>  Success" << endl;
+			// in case blocks don't overlap at all, also consider the
+			// blocks' distance as further cost
+			if (blocks_intersect.h == 0) {
+
+				if (Rect::rectA_below_rectB(req.s_i->bb, req.s_j->bb, false)) {
+
+					eval.addCost(req.s_j->bb.ll.y - req.s_i->bb.ur.y);
+
+					// annotate block-alignment failure
+					eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+					eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+				}
+				else {
+
+					eval.addCost(req.s_i->bb.ll.y - req.s_j->bb.ur.y);
+
+					// annotate block-alignment failure
+					eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+					eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+				}
+			}
+
+			// annotate general alignment failure
+			eval.fulfilled = false;
+		}
+	}
+	// max distance range
+	else if (req.range_max_y()) {
+
+		// consider the spatial mismatch as cost; distance too large
+		if (blocks_bb.h > req.alignment_y) {
+
+			eval.addCost(blocks_bb.h - req.alignment_y);
+
+			// annotate general alignment failure
+			eval.fulfilled = false;
+
+			// annotate block-alignment failure
+			if (req.s_i->bb.ll.y < req.s_j->bb.ll.y) {
+				eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+				eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
 			}
 			else {
-				cout << "DBG_ALIGNMENT>  Failure" << endl;
-				cout << "DBG_ALIGNMENT>   block " << req.s_i->id << ": " << req.s_i->alignment << endl;
-				cout << "DBG_ALIGNMENT>   block " << req.s_j->id << ": " << req.s_j->alignment << endl;
+				eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+				eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
 			}
 		}
+	}
+	// fixed alignment offset
+	else if (req.offset_y()) {
+
+		// check the blocks' offset against the required offset
+		if (!Math::doubleComp(req.s_j->bb.ll.y - req.s_i->bb.ll.y, req.alignment_y)) {
+
+			// s_j should be above s_i;
+			// consider the spatial mismatch as cost
+			if (req.alignment_y >= 0.0) {
 
-		// derive TSVs for vertical buses if desired; only consider fulfilled
-		// alignments
-		if (derive_TSVs && req.fulfilled) {
-
-			// consider valid block intersections independent of defined
-			// alignment; this way, all vertical buses arising from different
-			// alignment requests will be considered 
-			blocks_intersect = Rect::determineIntersection(req.s_i->bb, req.s_j->bb);
-			if (blocks_intersect.area != 0.0) {
-
-				// consider TSVs in all affected layers
-				for (int layer = min(req.s_i->layer, req.s_j->layer); layer < max(req.s_i->layer, req.s_j->layer); layer++) {
-
-					// init new bus
-					TSV_Group vert_bus = TSV_Group("bus_" + req.s_i->id + "_" + req.s_j->id, req.signals, layer);
-
-					// define bus outline; consider required area for
-					// given amount of TSVs
-					//
-					// note that the following code does _not_consider
-					// a sanity check where the required area for TSVs
-					// is larger than the intersection; since TSVs are
-					// assumed to be embedded into blocks later on
-					// anyway, such over-usage of block area is not
-					// critical
-
-					// init TSV group with actual intersection; this
-					// way, the lower-left corners of the TSV group
-					// and the actual intersection match
-					vert_bus.bb = blocks_intersect;
-
-					// minimal side of TSV-group rectangle is
-					// intersection's width
-					if (blocks_intersect.w < blocks_intersect.h) {
-
-						// determine maximal amount of TSVs to be
-						// put in smaller side of TSV-group
-						// rectangle
-						TSVs_row_col = floor(blocks_intersect.w / this->IC.TSV_pitch);
-
-						// define smaller side of actual TSV-group
-						// rectangle
-						vert_bus.bb.w = TSVs_row_col * this->IC.TSV_pitch;
-						vert_bus.bb.ur.x = vert_bus.bb.ll.x + vert_bus.bb.w;
-
-						// define larger side of actual TSV-group
-						// rectangle; ceil accounts for additional
-						// row of TSVs if they are not completely
-						// fitting, i.e., not filling a rectangle
-						vert_bus.bb.h = ceil(vert_bus.TSVs_count / TSVs_row_col) * this->IC.TSV_pitch;
-						vert_bus.bb.ur.y = vert_bus.bb.ll.y + vert_bus.bb.h;
+				// s_j is above s_i
+				if (req.s_j->bb.ll.y > req.s_i->bb.ll.y) {
+
+					// abs required for cases where s_j is too
+					// far lowerwards, i.e., not sufficiently
+					// away from s_i
+					eval.addCost(abs(req.s_j->bb.ll.y - req.s_i->bb.ll.y - req.alignment_y));
+
+					// annotate block-alignment failure;
+					// s_j is too far lowerwards, s_i too far upwards
+					if ((req.s_j->bb.ll.y - req.s_i->bb.ll.y - req.alignment_y) < 0) {
+						eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+						eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
 					}
-					// minimal side of TSV-group rectangle is
-					// intersection's height
+					// s_j is too far upwards, s_i too far
+					// lowerwards
 					else {
-						// determine maximal amount of TSVs to be
-						// put in smaller side of TSV-group
-						// rectangle
-						TSVs_row_col = floor(blocks_intersect.h / this->IC.TSV_pitch);
-
-						// define smaller side of actual TSV-group
-						// rectangle
-						vert_bus.bb.h = TSVs_row_col * this->IC.TSV_pitch;
-						vert_bus.bb.ur.y = vert_bus.bb.ll.y + vert_bus.bb.h;
-
-						// define larger side of actual TSV-group
-						// rectangle; ceil accounts for additional
-						// column of TSVs if they are not completely
-						// fitting, i.e., not filling a rectangle
-						vert_bus.bb.w = ceil(vert_bus.TSVs_count / TSVs_row_col) * this->IC.TSV_pitch;
-						vert_bus.bb.ur.x = vert_bus.bb.ll.x + vert_bus.bb.w;
+						eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+						eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
 					}
+				}
+				// s_j is below s_i
+				else {
+					// cost includes distance b/w (upper) s_i,
+					// (lower) s_j and the failed offset
+					eval.addCost(req.s_i->bb.ll.y - req.s_j->bb.ll.y + req.alignment_y);
 
-					// dbg logging for TSV generation
-					if (FloorPlanner::DBG_TSVS) {
+					// annotate block-alignment failure
+					eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+					eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+				}
+			}
+			// s_j should be below s_i;
+			// consider the spatial mismatch as cost
+			else {
+
+				// s_j is below s_i
+				if (req.s_j->bb.ll.y < req.s_i->bb.ll.y) {
 
-						cout << "DBG_TSVs> TSV group" << endl;
-						cout << "DBG_TSVs>  " << vert_bus.id << endl;
-						cout << "DBG_TSVs>  (" << vert_bus.bb.ll.x << "," << vert_bus.bb.ll.y << ")";
-						cout << "(" << vert_bus.bb.ur.x << "," << vert_bus.bb.ur.y << ")" << endl;
+					// abs required for cases where s_j is too
+					// far upwards, i.e., not sufficiently
+					// away from s_i
+					eval.addCost(abs(req.s_i->bb.ll.y - req.s_j->bb.ll.y + req.alignment_y));
+
+					// annotate block-alignment failure;
+					// s_j is too far upwards, s_i too far
+					// lowerwards
+					if ((req.s_i->bb.ll.y - req.s_j->bb.ll.y + req.alignment_y) < 0) {
+						eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+						eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+					}
+					// s_j is too far lowerwards, s_i too far
+					// upwards
+					else {
+						eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
+						eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
 					}
+				}
+				// s_j is above s_i
+				else {
+					// cost includes distance b/w (lower) s_i,
+					// (upper) s_j and the failed (negative) offset
+					eval.addCost(req.s_j->bb.ll.y - req.s_i->bb.ll.y - req.alignment_y);
 
-					// store bus
-					this->TSVs.push_back(move(vert_bus));
+					// annotate block-alignment failure
+					eval.s_i = Block::AlignmentStatus::FAIL_VERT_TOO_LOW;
+					eval.s_j = Block::AlignmentStatus::FAIL_VERT_TOO_HIGH;
 				}
 			}
-		}
-	}
-
-	// memorize max cost; initial sampling
-	if (set_max_cost) {
-		this->max_cost_alignments = cost.alignments;
-	}
 
-	// store actual value
-	cost.alignments_actual_value = cost.alignments;
-	// normalize value; refers to max value from initial sampling
-	cost.alignments /= this->max_cost_alignments;
-
-	if (FloorPlanner::DBG_CALLS_SA) {
-		cout << "<- FloorPlanner::evaluateAlignments : " << cost.alignments << endl;
+			// annotate general alignment failure
+			eval.fulfilled = false;
+		}
 	}
 }
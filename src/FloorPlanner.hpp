@@ -27,8 +27,12 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "Block.hpp"
+#include "BlocksGeometry.hpp"
 #include "Net.hpp"
+#include "Netlist.hpp"
 #include "ThermalAnalyzer.hpp"
+#include "ThreadPool.hpp"
+#include "Math.hpp"
 // forward declarations, if any
 class CorblivarCore;
 class CorblivarAlignmentReq;
@@ -41,6 +45,8 @@ class FloorPlanner {
 		static constexpr bool DBG_LAYOUT = false;
 		static constexpr bool DBG_ALIGNMENT = false;
 		static constexpr bool DBG_TSVS = false;
+		// cross-check incremental interconnects evaluation w/ full evaluation
+		static constexpr bool DBG_INTERCONNECTS = false;
 
 	// private data, functions
 	private:
@@ -48,8 +54,21 @@ class FloorPlanner {
 		vector<Block> blocks;
 		vector<Pin> terminals;
 		vector<Net> nets;
+		// blocks and terminal pins of all nets
+		Netlist netlist;
 
-		// groups of TSVs, will be defined from nets and vertical buses
+		// blocks' geometry and layer as contiguous store; updated during
+		// layout generation and to be read by the cost functions
+		BlocksGeometry geometry;
+
+		// outline of blocks on each die, i.e., their max upper-right
+		// coordinates; provided by the layout generation
+		vector<Point> dies_outline;
+
+		// groups of TSVs, will be defined from nets and vertical buses; for
+		// vertical buses, the groups are preallocated as table w/ one group for
+		// each alignment request and each layer (but the uppermost), see
+		// determVerticalBus; only groups flagged as active are in use
 		vector<TSV_Group> TSVs;
 
 		// dummy reference block, represents lower-left corner of dies
@@ -94,6 +113,15 @@ class FloorPlanner {
 			bool power_density_file_avail;
 			// similar flags for other files
 			bool alignments_file_avail;
+
+			IO_conf() = default;
+			// copies for SA chains; file streams are not copied, i.e., they
+			// remain w/ the original floorplanner
+			IO_conf(IO_conf const& conf) :
+				blocks_file(conf.blocks_file), alignments_file(conf.alignments_file), pins_file(conf.pins_file),
+				power_density_file(conf.power_density_file), nets_file(conf.nets_file), solution_file(conf.solution_file),
+				power_density_file_avail(conf.power_density_file_avail), alignments_file_avail(conf.alignments_file_avail) {
+			}
 		} IO_conf;
 
 		// benchmark name
@@ -134,6 +162,13 @@ class FloorPlanner {
 			bool layout_enhanced_hard_block_rotation, layout_enhanced_soft_block_shaping;
 			bool layout_power_aware_block_handling, layout_floorplacement;
 			int layout_packing_iterations;
+
+			// SA parameter: number of concurrent, independent SA chains;
+			// given as command-line parameter
+			int chains;
+			// SA parameter: number of replicas for replica-exchange SA, i.e.,
+			// parallel tempering; given as command-line parameter
+			int replicas;
 		} SA_parameters;
 
 		// SA cost variables: max cost values
@@ -182,7 +217,6 @@ class FloorPlanner {
 				bool const& set_max_cost = false);
 		void evaluateAlignments(Cost& cost,
 				vector<CorblivarAlignmentReq> const& alignments,
-				bool const& derive_TSVs = true,
 				bool const& set_max_cost = false);
 		void evaluateAreaOutline(Cost& cost,
 				double const& fitting_layouts_ratio = 0.0) const;
@@ -195,6 +229,101 @@ class FloorPlanner {
 		// non-trivial considers the bounding boxes on each layer separately
 		static constexpr bool SA_COST_INTERCONNECTS_TRIVIAL_HPWL = false;
 
+		// SA: incremental interconnects evaluation; nets are only re-evaluated if
+		// some of their blocks changed their geometry or layer since the previous
+		// evaluation
+		struct interconnects_cache {
+			// nets of each block, by index
+			vector< vector<unsigned> > blocks_nets;
+			// nets to be re-evaluated; as flags and as list
+			vector<bool> nets_dirty;
+			vector<unsigned> dirty_nets;
+			// previous values of nets to be re-evaluated
+			vector<double> dirty_nets_HPWL;
+			vector<int> dirty_nets_TSVs;
+			// chunks of nets to be re-evaluated concurrently, given as
+			// boundaries w/in list of nets
+			vector<unsigned> dirty_nets_chunks;
+			// accumulated values of all nets; HPWL in fixed point, see
+			// fixedHPWL
+			long long HPWL;
+			int TSVs;
+			// flag for (in)valid cache; invalid cache triggers evaluation of
+			// all nets
+			bool valid;
+		} interconnects_cache;
+
+		// SA: resolution [um] of the fixed-point HPWL accumulation; nets' HPWL
+		// values are rounded to multiples of this resolution, which is well
+		// below the precision of the blocks' coordinates
+		static constexpr double SA_COST_INTERCONNECTS_HPWL_RESOLUTION = 1.0e-06;
+		inline static long long fixedHPWL(double const& HPWL) {
+			return llround(HPWL / FloorPlanner::SA_COST_INTERCONNECTS_HPWL_RESOLUTION);
+		};
+
+		// SA: concurrent interconnects evaluation; nets are evaluated
+		// concurrently only if the re-evaluation is sufficiently expensive,
+		// i.e., considering the count of related blocks and pins
+		static constexpr unsigned SA_COST_INTERCONNECTS_CONCURRENT_MIN_PINS = 4096;
+		// chunks of nets for each thread; more chunks balance the load better
+		static constexpr unsigned SA_COST_INTERCONNECTS_CONCURRENT_CHUNKS = 4;
+
+		// thread pool for concurrent evaluation of nets; only available if
+		// initialized, see initThreadPool()
+		shared_ptr<ThreadPool> thread_pool;
+
+		// SA: helper for interconnects evaluation
+		void evaluateDirtyNets();
+		void determDirtyNetsChunks();
+		void determDirtyNets();
+		void evaluateNet(Net& net, Netlist const& netlist, BlocksGeometry const& geometry) const;
+
+		// SA: incremental alignments evaluation; requests are only re-evaluated
+		// if any of their blocks changed its geometry or layer since the
+		// previous evaluation
+		//
+		// evaluation of one request; the cost terms are memorized separately,
+		// in order to accumulate the overall cost in the very same order as for
+		// a full evaluation
+		struct AlignmentEval {
+			array<double,4> cost;
+			unsigned cost_terms;
+			bool fulfilled;
+			Block::AlignmentStatus s_i, s_j;
+
+			inline void addCost(double const& c) {
+				this->cost[this->cost_terms] = c;
+				this->cost_terms++;
+			};
+		};
+		struct alignments_cache {
+			// requests evaluated during previous evaluation
+			vector<CorblivarAlignmentReq> const* alignments;
+			// blocks involved in any request (but the RBOD), their index
+			// by numerical id, their requests and their last request; the
+			// latter defines the block's alignment status
+			vector<Block const*> blocks;
+			vector<int> blocks_index;
+			vector< vector<unsigned> > blocks_reqs;
+			vector<unsigned> blocks_last_req;
+			// blocks' geometry and layer during previous evaluation
+			vector<Rect> blocks_bb;
+			vector<int> blocks_layer;
+			// evaluation of each request
+			vector<AlignmentEval> reqs;
+			// requests to be re-evaluated; as flags and as list
+			vector<bool> reqs_dirty;
+			vector<unsigned> dirty_reqs;
+			// flag for (in)valid cache; invalid cache triggers evaluation of
+			// all requests
+			bool valid;
+		} alignments_cache;
+
+		// SA: helper for alignments evaluation
+		void determDirtyAlignments(vector<CorblivarAlignmentReq> const& alignments);
+		void evaluateAlignment(CorblivarAlignmentReq const& req, AlignmentEval& eval) const;
+		void determVerticalBus(CorblivarAlignmentReq const& req, unsigned const& r);
+
 		// SA parameter: scaling factor for loops during solution-space sampling
 		static constexpr int SA_SAMPLING_LOOP_FACTOR = 1;
 
@@ -266,6 +395,94 @@ class FloorPlanner {
 		void initSA(CorblivarCore& corb, vector<double>& cost_samples, int& innerLoopMax, double& init_temp);
 		inline void updateTemp(double& cur_temp, int const& iteration, int const& iteration_first_valid_layout) const;
 
+		// SA chains: helper to map blocks of the original floorplanner to the
+		// related blocks of a chain's copy, and vice versa
+		inline Block const* mapBlock(Block const* b, FloorPlanner const& fp) const {
+
+			if (b == &fp.RBOD) {
+				return &this->RBOD;
+			}
+			else {
+				return &this->blocks[b - &fp.blocks[0]];
+			}
+		};
+		// SA chains: initialize chain as copy of original floorplanner
+		void initChain(FloorPlanner const& fp, CorblivarCore& chain_corb, CorblivarCore const& corb);
+		// SA chains: adopt chain's current solution as best solution
+		void adoptChainSolution(CorblivarCore& corb, FloorPlanner const& chain, CorblivarCore const& chain_corb);
+
+		// SA replica exchange: state of one replica; POD declaration
+		struct Replica {
+			double temp;
+			double init_temp;
+			int innerLoopMax;
+			double cur_cost;
+			// current cost terms, required for comparison of replicas' costs
+			// w/ common fitting ratio, see replicaCost
+			double cur_area;
+			double cur_outline;
+			double cur_cost_others;
+			double avg_cost;
+			double best_cost;
+			double fitting_layouts_ratio;
+			bool fitting_layout_found;
+			bool valid_layout_found;
+			bool best_sol_found;
+			unsigned rand_state;
+		};
+
+		// SA replica exchange: targeted range for the acceptance rate of
+		// exchanges b/w adjacent replicas; the temperature ladder is widened or
+		// narrowed accordingly, after each given count of steps, see
+		// performSATempering
+		static constexpr double SA_TEMPERING_EXCHANGE_ACCEPTANCE_MIN = 0.2;
+		static constexpr double SA_TEMPERING_EXCHANGE_ACCEPTANCE_MAX = 0.3;
+		static constexpr int SA_TEMPERING_LADDER_ADAPTION_STEPS = 5;
+		// SA replica exchange: lower bound for ratio of lowest to highest
+		// temperature of ladder
+		static constexpr double SA_TEMPERING_TEMP_RATIO_MIN = 1.0e-6;
+		// SA replica exchange: geometric temperature ladder for given ratio of
+		// lowest to highest temperature; ladder[0] refers to hottest replica
+		inline static void setTemperingLadder(vector<Replica>& reps, vector<int> const& ladder, double const& init_temp, double const& temp_ratio) {
+
+			for (unsigned k = 0; k < ladder.size(); k++) {
+				reps[ladder[k]].temp = init_temp * pow(temp_ratio, static_cast<double>(k) / (ladder.size() - 1));
+			}
+		};
+
+		// SA replica exchange: fixed-temperature annealing steps for one replica
+		void performSAReplicaSteps(CorblivarCore& corb, Replica& rep, bool const& SA_phase_two);
+		// SA replica exchange: memorize replica's current cost and cost terms
+		inline static void memorizeReplicaCost(Replica& rep, Cost const& cost, bool const& SA_phase_two) {
+
+			rep.cur_cost = cost.total_cost;
+			rep.cur_area = cost.area_actual_value;
+			rep.cur_outline = cost.outline_actual_value;
+
+			if (!SA_phase_two) {
+				rep.cur_cost_others = 0.0;
+			}
+			else {
+				rep.cur_cost_others = cost.total_cost - cost.area_outline;
+			}
+		};
+		// SA replica exchange: replica's current cost, reconstructed from its cost
+		// terms for the given fitting ratio, see evaluateLayout and
+		// evaluateAreaOutline
+		inline static double replicaCost(Replica const& rep, double const& fitting_layouts_ratio, bool const& SA_phase_two) {
+			double cost_area_outline;
+
+			cost_area_outline = 0.5 * (1.0 - fitting_layouts_ratio) * rep.cur_outline
+				+ 0.5 * (1.0 + fitting_layouts_ratio) * rep.cur_area;
+
+			if (!SA_phase_two) {
+				return cost_area_outline;
+			}
+			else {
+				return rep.cur_cost_others + FloorPlanner::SA_COST_WEIGHT_AREA_OUTLINE * cost_area_outline;
+			}
+		};
+
 		// thermal analyzer
 		ThermalAnalyzer thermalAnalyzer;
 
@@ -279,7 +496,12 @@ class FloorPlanner {
 			ftime(&(this->time_start));
 
 			// init random number generator
-			srand(time(0));
+			Math::initRand(time(0));
+
+			// interconnects are not evaluated yet
+			this->interconnects_cache.valid = false;
+			// alignments are not evaluated yet
+			this->alignments_cache.valid = false;
 		}
 
 	// public data, functions
@@ -297,6 +519,16 @@ class FloorPlanner {
 			return (this->log >= LOG_MAXIMUM);
 		};
 
+		// init thread pool for concurrent evaluation of nets; the calling
+		// thread also handles nets, thus one thread less is required
+		inline void initThreadPool() {
+			unsigned threads = thread::hardware_concurrency();
+
+			if (threads > 1) {
+				this->thread_pool = make_shared<ThreadPool>(threads - 1);
+			}
+		};
+
 		// ThermalAnalyzer: handler
 		inline void initThermalAnalyzer() {
 
@@ -352,6 +584,9 @@ class FloorPlanner {
 
 			// rescale terminal pins' locations
 			this->scaleTerminalPins();
+
+			// pins have changed; all nets have to be re-evaluated
+			this->interconnects_cache.valid = false;
 		}
 
 		inline void scaleTerminalPins() {
@@ -380,8 +615,22 @@ class FloorPlanner {
 			return this->IO_conf.solution_in.is_open();
 		};
 
+		inline int const& getSAChains() const {
+			return this->SA_parameters.chains;
+		};
+
+		inline int const& getSAReplicas() const {
+			return this->SA_parameters.replicas;
+		};
+
 		// SA: handler
 		bool performSA(CorblivarCore& corb);
+		// SA: handler for multiple, concurrent SA chains; the best solution is
+		// handed back into corb
+		bool performSAChains(CorblivarCore& corb);
+		// SA: handler for replica-exchange SA, i.e., parallel tempering; the best
+		// solution is handed back into corb
+		bool performSATempering(CorblivarCore& corb);
 		void finalize(CorblivarCore& corb, bool const& determ_overall_cost = true, bool const& handle_corblivar = true);
 };
 
@@ -46,23 +46,50 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	stringstream nets_file;
 	string tmpstr;
 	ThermalAnalyzer::MaskParameters mask_parameters;
+	vector<string> params;
+
+	// default: one SA chain, no replica exchange
+	fp.SA_parameters.chains = 1;
+	fp.SA_parameters.replicas = 1;
+
+	// separate optional flags from positional parameters; note that params[0]
+	// refers to argv[1]
+	for (int i = 1; i < argc; i++) {
+
+		tmpstr = argv[i];
+
+		// number of concurrent SA chains
+		if (tmpstr == "--chains" && i + 1 < argc) {
+			fp.SA_parameters.chains = max(1, atoi(argv[++i]));
+		}
+		// number of replicas for replica-exchange SA
+		else if (tmpstr == "--replicas" && i + 1 < argc) {
+			fp.SA_parameters.replicas = max(1, atoi(argv[++i]));
+		}
+		else {
+			params.push_back(tmpstr);
+		}
+	}
+	tmpstr.clear();
 
 	// print command-line parameters
-	if (argc < 4) {
-		cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [solution_file] [TSV_density]" << endl;
+	if (params.size() < 3) {
+		cout << "IO> Usage: " << argv[0] << " benchmark_name config_file benchmarks_dir [solution_file] [TSV_density] [--chains N] [--replicas K]" << endl;
 		cout << "IO> " << endl;
 		cout << "IO> Mandatory parameter ``benchmark_name'': any name, should refer to GSRC-Bookshelf benchmark" << endl;
 		cout << "IO> Mandatory parameter ``config_file'' format: see provided Corblivar.conf" << endl;
 		cout << "IO> Mandatory parameter ``benchmarks_dir'': folder containing actual benchmark files in GSRC Bookshelf format" << endl;
 		cout << "IO> Optional parameter ``solution_file'': re-evaluate w/ given Corblivar solution" << endl;
 		cout << "IO> Optional parameter ``TSV density'': average TSV density to be considered across all dies, to be given in \%" << endl;
+		cout << "IO> Optional flag ``--chains N'': run N independent SA chains concurrently, the best solution is kept" << endl;
+		cout << "IO> Optional flag ``--replicas K'': run replica-exchange SA (parallel tempering) w/ K concurrent replicas" << endl;
 
 		exit(1);
 	}
 
 	// TSV density given; note special run mode where only thermal-analysis result is
 	// output, not all other (time-consuming) date
-	if (argc == 6) {
+	if (params.size() == 5) {
 		fp.thermal_analyser_run = true;
 	}
 	else {
@@ -70,23 +97,23 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	}
 
 	// read in mandatory parameters
-	fp.benchmark = argv[1];
+	fp.benchmark = params[0];
 
-	config_file = argv[2];
+	config_file = params[1];
 
-	blocks_file << argv[3] << fp.benchmark << ".blocks";
+	blocks_file << params[2] << fp.benchmark << ".blocks";
 	fp.IO_conf.blocks_file = blocks_file.str();
 
-	alignments_file << argv[3] << fp.benchmark << ".alr";
+	alignments_file << params[2] << fp.benchmark << ".alr";
 	fp.IO_conf.alignments_file = alignments_file.str();
 
-	pins_file << argv[3] << fp.benchmark << ".pl";
+	pins_file << params[2] << fp.benchmark << ".pl";
 	fp.IO_conf.pins_file = pins_file.str();
 
-	power_density_file << argv[3] << fp.benchmark << ".power";
+	power_density_file << params[2] << fp.benchmark << ".power";
 	fp.IO_conf.power_density_file = power_density_file.str();
 
-	nets_file << argv[3] << fp.benchmark << ".nets";
+	nets_file << params[2] << fp.benchmark << ".nets";
 	fp.IO_conf.nets_file = nets_file.str();
 
 	results_file << fp.benchmark << ".results";
@@ -176,9 +203,9 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	// additional command-line parameters
 	//
 	// additional parameter for solution file given; consider file for readin
-	if (argc > 4) {
+	if (params.size() > 3) {
 
-		fp.IO_conf.solution_file = argv[4];
+		fp.IO_conf.solution_file = params[3];
 		// open file if possible
 		fp.IO_conf.solution_in.open(fp.IO_conf.solution_file.c_str());
 		if (!fp.IO_conf.solution_in.good())
@@ -195,8 +222,8 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 	}
 
 	// additional parameter for TSV density given, in percent
-	if (argc == 6) {
-		mask_parameters.TSV_density = atof(argv[5]);
+	if (params.size() == 5) {
+		mask_parameters.TSV_density = atof(params[4].c_str());
 	}
 	// otherwise assume a setup w/o regularly spread TSVs, i.e., TSV density is zero
 	else {
@@ -597,6 +624,8 @@ void IO::parseParametersFiles(FloorPlanner& fp, int const& argc, char** argv) {
 		// SA loop setup
 		cout << "IO>  SA -- Inner-loop operation-factor a (ops = N^a for N blocks): " << fp.SA_parameters.loopFactor << endl;
 		cout << "IO>  SA -- Outer-loop upper limit: " << fp.SA_parameters.loopLimit << endl;
+		cout << "IO>  SA -- Concurrent chains: " << fp.SA_parameters.chains << endl;
+		cout << "IO>  SA -- Replicas for replica exchange: " << fp.SA_parameters.replicas << endl;
 
 		// SA cooling schedule
 		cout << "IO>  SA -- Start temperature scaling factor: " << fp.SA_parameters.temp_init_factor << endl;
@@ -712,6 +741,9 @@ void IO::parseCorblivarFile(FloorPlanner& fp, CorblivarCore& corb) {
 		}
 	}
 
+	// update map of blocks to tuples and journals for parsed CBLs
+	corb.handleEditedCBLs();
+
 	if (fp.logMed()) {
 		cout << "IO> ";
 		cout << "Done; parsed " << tuples << " tuples" << endl << endl;
@@ -1094,7 +1126,8 @@ void IO::parseBlocks(FloorPlanner& fp) {
 		fp.IC.blocks_area += new_block.bb.area;
 		blocks_max_area = max(blocks_max_area, new_block.bb.area);
 
-		// store block
+		// store block, along w/ its dense index
+		new_block.numerical_id = fp.blocks.size();
 		fp.blocks.push_back(move(new_block));
 	}
 
@@ -1206,6 +1239,7 @@ void IO::parseNets(FloorPlanner& fp) {
 
 	// reset nets
 	fp.nets.clear();
+	fp.netlist.clear();
 
 	// open nets file
 	in.open(fp.IO_conf.nets_file.c_str());
@@ -1239,9 +1273,9 @@ void IO::parseNets(FloorPlanner& fp) {
 			break;
 		}
 
-		// read in blocks and terminals of net
-		new_net.blocks.clear();
-		new_net.terminals.clear();
+		// read in blocks and terminals of net; they are stored in the
+		// netlist
+		fp.netlist.addNet();
 		for (i = 0; i < net_degree; i++) {
 
 			// parse block / pin id
@@ -1253,7 +1287,7 @@ void IO::parseNets(FloorPlanner& fp) {
 				// mark net as net w/ external pin
 				new_net.hasExternalPin = true;
 				// store terminal
-				new_net.terminals.push_back(move(pin));
+				fp.netlist.addTerminal(pin);
 				// pin found
 				pin_not_found = false;
 			}
@@ -1267,7 +1301,7 @@ void IO::parseNets(FloorPlanner& fp) {
 				block = Block::findBlock(net_block, fp.blocks);
 				if (block != nullptr) {
 					// store block
-					new_net.blocks.push_back(move(block));
+					fp.netlist.addBlock(block);
 					// block found
 					block_not_found = false;
 				}
@@ -1308,14 +1342,14 @@ void IO::parseNets(FloorPlanner& fp) {
 			cout << "DBG_IO> ";
 			cout << "net " << n.id << endl;
 
-			for (Block const* block : n.blocks) {
+			for (unsigned b = fp.netlist.blocksBegin(n.id); b < fp.netlist.blocksEnd(n.id); b++) {
 				cout << "DBG_IO> ";
-				cout << " block " << block->id << endl;
+				cout << " block " << fp.blocks[fp.netlist.blocks[b]].id << endl;
 			}
 
-			for (Pin const* pin : n.terminals) {
+			for (unsigned t = fp.netlist.terminalsBegin(n.id); t < fp.netlist.terminalsEnd(n.id); t++) {
 				cout << "DBG_IO> ";
-				cout << " pin " << pin->id << endl;
+				cout << " pin " << fp.netlist.terminals[t]->id << endl;
 			}
 		}
 	}
@@ -1868,7 +1902,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, vector<CorblivarAlignmentReq>
 		// output TSVs (blocks)
 		for (TSV_Group const& TSV_group : fp.TSVs) {
 
-			if (TSV_group.layer != cur_layer) {
+			if (!TSV_group.active || TSV_group.layer != cur_layer) {
 				continue;
 			}
 
@@ -1901,7 +1935,7 @@ void IO::writeFloorplanGP(FloorPlanner const& fp, vector<CorblivarAlignmentReq>
 			// related intersection/offset to illustrate block alignment
 			for (CorblivarAlignmentReq const& req :  alignment) {
 
-				if (req.s_i->id == cur_block.id || req.s_j->id == cur_block.id) {
+				if (req.s_i->numerical_id == cur_block.numerical_id || req.s_j->numerical_id == cur_block.numerical_id) {
 
 					// init alignment flags; -1 equals undefined
 					req_x_fulfilled = req_y_fulfilled = -1;
@@ -43,6 +43,16 @@ class Math {
 
 	// public data, functions
 	public:
+		// random-number generator; state is kept per thread, required for
+		// concurrent SA chains, see FloorPlanner::performSAChains
+		inline static unsigned& randState() {
+			static thread_local unsigned state = 1;
+			return state;
+		};
+		inline static void initRand(unsigned const& seed) {
+			Math::randState() = seed;
+		};
+
 		// random-number functions
 		// note: range is [min, max)
 		inline static int randI(int const& min, int const& max) {
@@ -50,15 +60,15 @@ class Math {
 				return min;
 			}
 			else {
-				return min + (rand() % (max - min));
+				return min + (rand_r(&Math::randState()) % (max - min));
 			}
 		};
 		inline static bool randB() {
-			int const r = rand();
+			int const r = rand_r(&Math::randState());
 			return (r < (RAND_MAX / 2));
 		};
 		inline static double randF(double const& min, double const& max) {
-			double const r = static_cast<double>(rand()) / RAND_MAX;
+			double const r = static_cast<double>(rand_r(&Math::randState())) / RAND_MAX;
 			return r * (max - min) + min;
 		};
 
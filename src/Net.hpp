@@ -27,6 +27,8 @@
 #include "Corblivar.incl.hpp"
 // Corblivar includes, if any
 #include "Block.hpp"
+#include "Netlist.hpp"
+#include "BoundingBoxKernel.hpp"
 #include "Rect.hpp"
 // forward declarations, if any
 
@@ -45,115 +47,125 @@ class Net {
 			this->hasExternalPin = false;
 			this->layer_bottom = -1;
 			this->layer_top = -1;
+			this->HPWL = 0.0;
+			this->TSVs = 0;
 		};
 
 	// public data, functions
 	public:
 		int id;
 		bool hasExternalPin;
-		vector<Block const*> blocks;
-		vector<Pin const*> terminals;
-		mutable int layer_bottom, layer_top;
+		// note that blocks and terminal pins are given by the netlist
+		int layer_bottom, layer_top;
+
+		// cached interconnect values, see FloorPlanner::evaluateInterconnects;
+		// bounding boxes for each layer, valid up to layer_top; see
+		// determBoundingBoxes
+		vector<Rect> bb;
+		double HPWL;
+		int TSVs;
+
+		// determine layer boundaries, i.e., lowest and uppermost layer of net's
+		// blocks, and the bounding boxes on each layer up to layer_top; w/o any
+		// temporary allocations, the per-layer boxes of the blocks are provided
+		// by the (vectorized) BoundingBoxKernel. The bounding box on some layer
+		// covers the blocks on this layer, the blocks on the next layer above
+		// which contains any blocks, and (for the lowermost layer) the terminal
+		// pins; it is required to assume a reasonable bounding box w/o actual
+		// placement of TSVs. Layers w/o blocks and the uppermost layer w/ only
+		// one block are represented by empty boxes; these cases are already
+		// covered while considering layers below
+		inline void determBoundingBoxes(Netlist const& netlist, int const& layers) {
+			int i;
+			unsigned t;
+			unsigned blocks_layer_top;
+			Rect bb_above, bb_layer;
 
-		inline void setLayerBoundaries() const {
+			if (Net::DBG) {
+				cout << "DBG_NET>   Determine bbs for net " << this->id << endl;
+			}
 
-			if (this->blocks.empty()) {
-				return;
+			// fixed-size array of bbs, one for each layer; allocated once
+			if (this->bb.size() != static_cast<unsigned>(layers)) {
+				this->bb.resize(layers);
 			}
-			else {
-				this->layer_bottom = this->layer_top = this->blocks[0]->layer;
 
-				for (Block const* b : this->blocks) {
-					this->layer_bottom = min(this->layer_bottom, b->layer);
-					this->layer_top = max(this->layer_top, b->layer);
-				}
+			if (netlist.blocksBegin(this->id) == netlist.blocksEnd(this->id)) {
+				return;
 			}
-		};
 
+			// init bbs as empty boxes
+			for (Rect& bb : this->bb) {
+				bb.ll.x = bb.ll.y = numeric_limits<double>::max();
+				bb.ur.x = bb.ur.y = numeric_limits<double>::lowest();
+			}
 
-		inline Rect determBoundingBox(int const& layer) const {
-			int i;
-			vector<Rect const*> blocks_to_consider;
-			bool blocks_above_considered;
-			// dummy return value
-			Rect bb;
+			// blocks on each layer; also memorize the count of blocks on the
+			// uppermost layer
+			BoundingBoxKernel::determLayerBoxes(netlist, this->id, this->bb, this->layer_bottom, this->layer_top, blocks_layer_top);
 
-			if (Net::DBG) {
-				cout << "DBG_NET>   Determine bb for net " << this->id << " on layer " << layer << endl;
-			}
+			// also consider routes to terminal pins; only on lowest die of
+			// stack since connections b/w terminal pins and blocks on upper
+			// dies are routed through the TSV in that lowermost die
+			for (t = netlist.terminalsBegin(this->id); t < netlist.terminalsEnd(this->id); t++) {
 
-			// blocks / pins for cur_net on this layer
-			for (Block const* b : this->blocks) {
+				Pin const* pin = netlist.terminals[t];
 
-				// blocks
-				if (b->layer == layer) {
-					blocks_to_consider.push_back(&b->bb);
+				Net::extendBoundingBox(this->bb[0], pin->bb.ll.x, pin->bb.ll.y, pin->bb.ur.x, pin->bb.ur.y);
 
-					if (Net::DBG) {
-						cout << "DBG_NET> 	Consider block " << b->id << " on layer " << layer << endl;
-					}
+				if (this->layer_top == 0) {
+					blocks_layer_top++;
 				}
 
-				// also consider routes to terminal pins; only on lowest
-				// die of stack since connections b/w terminal pins and
-				// blocks on upper dies are routed through the TSV in that
-				// lowermost die
-				if (layer == 0) {
-					for (Pin const* pin :  this->terminals) {
-						blocks_to_consider.push_back(&pin->bb);
-
-						if (Net::DBG) {
-							cout << "DBG_NET> 	Consider terminal pin " << pin->id << endl;
-						}
-					}
+				if (Net::DBG) {
+					cout << "DBG_NET> 	Consider terminal pin " << pin->id << endl;
 				}
 			}
-			// ignore cases with no blocks on current layer
-			if (blocks_to_consider.empty()) {
-				return bb;
-			}
 
-			// blocks on the layer above; required to assume a reasonable
-			// bounding box on current layer w/o actual placement of TSVs; the
-			// layer to consider is not necessarily the adjacent one, thus
-			// stepwise consider layers until some blocks are found
-			blocks_above_considered = false;
-			i = layer + 1;
-			while (i <= this->layer_top) {
-				for (Block const* b : this->blocks) {
-					if (b->layer == i) {
-						blocks_to_consider.push_back(&b->bb);
-						blocks_above_considered = true;
-
-						if (Net::DBG) {
-							cout << "DBG_NET> 	Consider block " << b->id << " on layer " << i << endl;
-						}
-					}
+			// derive the actual bbs, walking the layers downwards; the bb of
+			// the next layer above w/ any blocks is memorized
+			bb_above = Rect();
+			for (i = this->layer_top; i >= 0; i--) {
+
+				bb_layer = this->bb[i];
+
+				// ignore layers w/o blocks
+				if (bb_layer.ll.x > bb_layer.ur.x) {
+					this->bb[i] = Rect();
+
+					continue;
 				}
 
-				// loop handler
-				if (blocks_above_considered) {
-					break;
+				// ignore single block on uppermost layer
+				if (i == this->layer_top && blocks_layer_top == 1) {
+					this->bb[i] = Rect();
+
+					if (Net::DBG) {
+						cout << "DBG_NET> 	Ignore single block on uppermost layer" << endl;
+					}
 				}
+				// consider blocks on next layer above, if any
 				else {
-					i++;
-				}
-			}
-
-			// ignore cases where only one block on the uppermost
-			// layer needs to be considered; these cases are already
-			// covered while considering layers below
-			if (blocks_to_consider.size() == 1 && layer == this->layer_top) {
+					if (i < this->layer_top) {
+						Net::extendBoundingBox(this->bb[i], bb_above.ll.x, bb_above.ll.y, bb_above.ur.x, bb_above.ur.y);
+					}
 
-				if (Net::DBG) {
-					cout << "DBG_NET> 	Ignore single block on uppermost layer" << endl;
+					this->bb[i].w = this->bb[i].ur.x - this->bb[i].ll.x;
+					this->bb[i].h = this->bb[i].ur.y - this->bb[i].ll.y;
+					this->bb[i].area = this->bb[i].w * this->bb[i].h;
 				}
 
-				return bb;
+				bb_above = bb_layer;
 			}
-
-			return Rect::determBoundingBox(blocks_to_consider);
 		}
+
+		// helper to extend bounding box by the box of some block / pin
+		inline static void extendBoundingBox(Rect& bb, double const& ll_x, double const& ll_y, double const& ur_x, double const& ur_y) {
+			bb.ll.x = min(bb.ll.x, ll_x);
+			bb.ll.y = min(bb.ll.y, ll_y);
+			bb.ur.x = max(bb.ur.x, ur_x);
+			bb.ur.y = max(bb.ur.y, ur_y);
+		};
 };
 
 #endif
@@ -0,0 +1,124 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar netlist, compressed-sparse-row representation of all nets
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_NETLIST
+#define _CORBLIVAR_NETLIST
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+#include "Block.hpp"
+#include "BlocksGeometry.hpp"
+// forward declarations, if any
+
+// Blocks and terminal pins of all nets, in compressed-sparse-row format: the blocks of
+// net n are given by their numerical ids in blocks[blocks_offsets[n]] up to
+// blocks[blocks_offsets[n + 1] - 1]; the same applies for the terminal pins. Blocks
+// are thus not referred to by pointers, i.e., the netlist is also valid for copies of
+// the blocks, as used for SA chains. Terminal pins are not modified during SA, they are
+// referred to by pointers. The geometry and layer of the nets' blocks are also held
+// here, contiguously in the order of the netlist; they are to be updated from the
+// blocks' geometry store before nets are evaluated, see updateBlocksGeometry
+class Netlist {
+	// constructors, destructors, if any non-implicit
+	public:
+		Netlist() {
+			this->clear();
+		};
+
+	// public data, functions
+	public:
+		vector<unsigned> blocks_offsets;
+		vector<unsigned> blocks;
+		vector<double> blocks_ll_x, blocks_ll_y;
+		vector<double> blocks_ur_x, blocks_ur_y;
+		vector<int> blocks_layer;
+		vector<unsigned> terminals_offsets;
+		vector<Pin const*> terminals;
+
+		inline void clear() {
+			this->blocks_offsets.assign(1, 0);
+			this->blocks.clear();
+			this->blocks_ll_x.clear();
+			this->blocks_ll_y.clear();
+			this->blocks_ur_x.clear();
+			this->blocks_ur_y.clear();
+			this->blocks_layer.clear();
+			this->terminals_offsets.assign(1, 0);
+			this->terminals.clear();
+		};
+
+		// building the netlist; blocks and pins are always added to the
+		// latest net
+		inline void addNet() {
+			this->blocks_offsets.push_back(this->blocks.size());
+			this->terminals_offsets.push_back(this->terminals.size());
+		};
+		inline void addBlock(Block const* block) {
+			this->blocks.push_back(block->numerical_id);
+			this->blocks_ll_x.push_back(0.0);
+			this->blocks_ll_y.push_back(0.0);
+			this->blocks_ur_x.push_back(0.0);
+			this->blocks_ur_y.push_back(0.0);
+			this->blocks_layer.push_back(-1);
+			this->blocks_offsets.back()++;
+		};
+		inline void addTerminal(Pin const* pin) {
+			this->terminals.push_back(pin);
+			this->terminals_offsets.back()++;
+		};
+
+		inline unsigned size() const {
+			return this->blocks_offsets.size() - 1;
+		};
+
+		// ranges of net's blocks and terminal pins; to be used as [begin, end)
+		inline unsigned blocksBegin(unsigned const& net) const {
+			return this->blocks_offsets[net];
+		};
+		inline unsigned blocksEnd(unsigned const& net) const {
+			return this->blocks_offsets[net + 1];
+		};
+		inline unsigned terminalsBegin(unsigned const& net) const {
+			return this->terminals_offsets[net];
+		};
+		inline unsigned terminalsEnd(unsigned const& net) const {
+			return this->terminals_offsets[net + 1];
+		};
+		// update geometry and layer of net's blocks
+		inline void updateBlocksGeometry(unsigned const& net, BlocksGeometry const& geometry) {
+
+			for (unsigned b = this->blocksBegin(net); b < this->blocksEnd(net); b++) {
+				this->blocks_ll_x[b] = geometry.ll_x[this->blocks[b]];
+				this->blocks_ll_y[b] = geometry.ll_y[this->blocks[b]];
+				this->blocks_ur_x[b] = geometry.ur_x[this->blocks[b]];
+				this->blocks_ur_y[b] = geometry.ur_y[this->blocks[b]];
+				this->blocks_layer[b] = geometry.layer[this->blocks[b]];
+			}
+		};
+
+		inline bool hasTerminals(unsigned const& net) const {
+			return this->terminals_offsets[net] != this->terminals_offsets[net + 1];
+		};
+};
+
+#endif
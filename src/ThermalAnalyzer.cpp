@@ -32,6 +32,8 @@
 
 // memory allocation
 constexpr int ThermalAnalyzer::POWER_MAPS_DIM;
+constexpr int ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+constexpr int ThermalAnalyzer::THERMAL_MAP_DIM;
 
 void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline) {
 	unsigned b;
@@ -44,6 +46,24 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 
 	this->power_maps.clear();
 
+	// the thermal map has to be fully determined again, i.e., it cannot be
+	// updated via delta of power maps
+	this->thermal_map_valid = false;
+	for (auto& m : this->power_map_collapsed) {
+		m.fill(0.0);
+	}
+	for (auto& m : this->power_map_delta) {
+		m.fill(0.0);
+	}
+	this->power_density_max = 0.0;
+
+	// similarly, the power maps have to be fully determined again
+	this->power_maps_valid = false;
+	this->power_maps_region.reset();
+	this->blocks_rasterized.clear();
+	this->TSV_groups_rasterized.clear();
+	this->nets_TSVs_rasterized.clear();
+
 	// allocate power-maps arrays
 	for (i = 0; i < layers; i++) {
 		this->power_maps.emplace_back(
@@ -51,6 +71,10 @@ void ThermalAnalyzer::initPowerMaps(int const& layers, Point const& die_outline)
 		);
 	}
 
+	// allocate difference maps for rasterization
+	this->power_maps_diff.clear();
+	this->power_maps_diff.resize(layers);
+
 	// init the maps w/ zero values
 	init_bin.power_density = init_bin.TSV_density = 0.0;
 	for (i = 0; i < layers; i++) {
@@ -112,6 +136,9 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 	// reset mask arrays
 	this->thermal_masks.clear();
 
+	// changed masks require to fully determine the thermal map again
+	this->thermal_map_valid = false;
+
 	// allocate mask arrays
 	for (i = 0; i < layers; i++) {
 		this->thermal_masks.emplace_back(
@@ -150,6 +177,36 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 		}
 	}
 
+	// determine whether all masks share the shape of the lowermost mask, i.e.,
+	// whether they only differ by a constant amplitude factor; if so, the power
+	// blurring can be performed on collapsed power maps
+	this->thermal_masks_collapsible = true;
+	this->thermal_masks_amplitudes.clear();
+	this->thermal_masks_amplitudes_sum = 0.0;
+
+	for (i = 0; i < layers; i++) {
+
+		// amplitude ratio is given by the mask centers
+		this->thermal_masks_amplitudes.push_back(
+				this->thermal_masks[i][ThermalAnalyzer::THERMAL_MASK_CENTER] /
+				this->thermal_masks[0][ThermalAnalyzer::THERMAL_MASK_CENTER]
+			);
+		this->thermal_masks_amplitudes_sum += this->thermal_masks_amplitudes[i];
+
+		// all other mask elements have to follow the same ratio
+		for (x_y = 0; x_y < ThermalAnalyzer::THERMAL_MASK_DIM; x_y++) {
+
+			if (abs(this->thermal_masks[i][x_y] - this->thermal_masks_amplitudes[i] * this->thermal_masks[0][x_y])
+					> ThermalAnalyzer::THERMAL_MASKS_SHAPE_TOLERANCE * this->thermal_masks[i][x_y]) {
+				this->thermal_masks_collapsible = false;
+			}
+		}
+	}
+
+	if (ThermalAnalyzer::DBG) {
+		cout << "DBG> Thermal masks share same shape: " << this->thermal_masks_collapsible << endl;
+	}
+
 	if (ThermalAnalyzer::DBG) {
 		// enforce fixed digit count for printing mask
 		cout << fixed;
@@ -179,147 +236,76 @@ void ThermalAnalyzer::initThermalMasks(int const& layers, bool const& log, MaskP
 }
 
 void ThermalAnalyzer::generatePowerMaps(int const& layers, vector<Block> const& blocks, Point const& die_outline, MaskParameters const& parameters, bool const& extend_boundary_blocks_into_padding_zone) {
-	int i;
-	int x, y;
-	Rect bin, intersect, block_offset;
-	int x_lower, x_upper, y_lower, y_upper;
-	bool padding_zone;
-	ThermalAnalyzer::PowerMapBin init_bin;
+	unsigned b;
+	Rect block_offset;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		cout << "-> ThermalAnalyzer::generatePowerMaps(" << layers << ", " << &blocks << ", (" << die_outline.x << ", " << die_outline.y << "), " << &parameters << ", " << extend_boundary_blocks_into_padding_zone << ")" << endl;
 	}
 
-	init_bin.power_density = 0.0;
-	init_bin.TSV_density = 0.0;
-
-	// determine maps for each layer
-	for (i = 0; i < layers; i++) {
+	// the power maps are determined only for the region of bins covered by
+	// changed blocks, TSV groups or nets' TSVs; the actual update is performed
+	// once all of them are memorized, see adaptPowerMaps; initially, or after
+	// changes of the blocks' count, all bins are to be determined
+	if (!this->power_maps_valid || this->blocks_rasterized.size() != blocks.size()) {
+		this->power_maps_region.setFull();
+		this->blocks_rasterized.assign(blocks.size(), {Rect(), -1, 0.0});
+	}
 
-		// reset map to zero
-		// note: this also implicitly pads the map w/ zero power density
-		for (auto& m : this->power_maps[i]) {
-			m.fill(init_bin);
-		}
+	// memorize each block's rasterization, i.e., its offset bb, layer and power
+	// density
+	for (b = 0; b < blocks.size(); b++) {
 
-		// consider each block on the related layer
-		for (Block const& block : blocks) {
+		Block const& block = blocks[b];
 
-			// drop blocks assigned to other layers
-			if (block.layer != i) {
-				continue;
-			}
+		// determine offset, i.e., shifted, block bb; relates to block's
+		// bb in padded power map
+		block_offset = block.bb;
 
-			// determine offset, i.e., shifted, block bb; relates to block's
-			// bb in padded power map
-			block_offset = block.bb;
+		// don't offset blocks at the left/lower chip boundaries,
+		// implicitly extend them into power-map padding zone; this way,
+		// during convolution, the thermal estimate increases for these
+		// blocks; blocks not at the boundaries are shifted
+		if (extend_boundary_blocks_into_padding_zone && block.bb.ll.x == 0.0) {
+		}
+		else {
+			block_offset.ll.x += this->blocks_offset_x;
+		}
+		if (extend_boundary_blocks_into_padding_zone && block.bb.ll.y == 0.0) {
+		}
+		else {
+			block_offset.ll.y += this->blocks_offset_y;
+		}
 
-			// don't offset blocks at the left/lower chip boundaries,
-			// implicitly extend them into power-map padding zone; this way,
-			// during convolution, the thermal estimate increases for these
-			// blocks; blocks not at the boundaries are shifted
-			if (extend_boundary_blocks_into_padding_zone && block.bb.ll.x == 0.0) {
-			}
-			else {
-				block_offset.ll.x += this->blocks_offset_x;
-			}
-			if (extend_boundary_blocks_into_padding_zone && block.bb.ll.y == 0.0) {
-			}
-			else {
-				block_offset.ll.y += this->blocks_offset_y;
-			}
+		// also consider extending blocks into right/upper padding zone if
+		// they are close to the related chip boundaries
+		if (
+				extend_boundary_blocks_into_padding_zone &&
+				abs(die_outline.x - block.bb.ur.x) < this->padding_right_boundary_blocks_distance
+		   ) {
+			// consider offset twice in order to reach right/uppper
+			// boundary related to layout described by padded power map
+			block_offset.ur.x = die_outline.x + 2.0 * this->blocks_offset_x;
+		}
+		// simple shift otherwise; compensate for padding of left/bottom
+		// boundaries
+		else {
+			block_offset.ur.x += this->blocks_offset_x;
+		}
 
-			// also consider extending blocks into right/upper padding zone if
-			// they are close to the related chip boundaries
-			if (
-					extend_boundary_blocks_into_padding_zone &&
-					abs(die_outline.x - block.bb.ur.x) < this->padding_right_boundary_blocks_distance
-			   ) {
-				// consider offset twice in order to reach right/uppper
-				// boundary related to layout described by padded power map
-				block_offset.ur.x = die_outline.x + 2.0 * this->blocks_offset_x;
-			}
-			// simple shift otherwise; compensate for padding of left/bottom
-			// boundaries
-			else {
-				block_offset.ur.x += this->blocks_offset_x;
-			}
+		if (
+				extend_boundary_blocks_into_padding_zone
+				&& abs(die_outline.y - block.bb.ur.y) < this->padding_upper_boundary_blocks_distance
+		   ) {
+			block_offset.ur.y = die_outline.y + 2.0 * this->blocks_offset_y;
+		}
+		else {
+			block_offset.ur.y += this->blocks_offset_y;
+		}
 
-			if (
-					extend_boundary_blocks_into_padding_zone
-					&& abs(die_outline.y - block.bb.ur.y) < this->padding_upper_boundary_blocks_distance
-			   ) {
-				block_offset.ur.y = die_outline.y + 2.0 * this->blocks_offset_y;
-			}
-			else {
-				block_offset.ur.y += this->blocks_offset_y;
-			}
-
-			// determine index boundaries for offset block; based on boundary
-			// of blocks and the covered bins; note that cast to int truncates
-			// toward zero, i.e., performs like floor for positive numbers
-			x_lower = static_cast<int>(block_offset.ll.x / this->power_maps_dim_x);
-			y_lower = static_cast<int>(block_offset.ll.y / this->power_maps_dim_y);
-			// +1 in order to efficiently emulate the result of ceil(); limit
-			// upper bound to power-maps dimenions
-			x_upper = min(static_cast<int>(block_offset.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-			y_upper = min(static_cast<int>(block_offset.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-
-			// walk power-map bins covering block outline
-			for (x = x_lower; x < x_upper; x++) {
-				for (y = y_lower; y < y_upper; y++) {
-
-					// determine if bin w/in padding zone
-					if (
-							x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| x >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-							|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
-							|| y >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
-					   ) {
-						padding_zone = true;
-					}
-					else {
-						padding_zone = false;
-					}
+		this->memorizeRasterizedRect(this->blocks_rasterized[b], block_offset, block.layer, block.power_density);
 
-					// consider full block power density for fully covered bins
-					if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density;
-						}
-					}
-					// else consider block power according to
-					// intersection of current bin and block
-					else {
-						// determine real coords of map bin
-						bin.ll.x = this->power_maps_bins_ll_x[x];
-						bin.ll.y = this->power_maps_bins_ll_y[y];
-						// note that +1 is guaranteed to be within bounds
-						// of power_maps_bins_ll_x/y (size =
-						// ThermalAnalyzer::POWER_MAPS_DIM + 1); the
-						// related last tuple describes the upper-right
-						// corner coordinates of the right/top boundary
-						bin.ur.x = this->power_maps_bins_ll_x[x + 1];
-						bin.ur.y = this->power_maps_bins_ll_y[y + 1];
-
-						// determine intersection
-						intersect = Rect::determineIntersection(bin, block_offset);
-						// normalize to full bin area
-						intersect.area /= this->power_maps_bin_area;
-
-						if (padding_zone) {
-							this->power_maps[i][x][y].power_density += block.power_density * intersect.area * parameters.power_density_scaling_padding_zone;
-						}
-						else {
-							this->power_maps[i][x][y].power_density += block.power_density * intersect.area;
-						}
-					}
-				}
-			}
-		}
+		this->power_density_max = max(this->power_density_max, block.power_density);
 	}
 
 	if (ThermalAnalyzer::DBG_CALLS) {
@@ -329,81 +315,61 @@ void ThermalAnalyzer::generatePowerMaps(int const& layers, vector<Block> const&
 
 void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const& TSVs, vector<Net> const& nets, double const& TSV_pitch, MaskParameters const& parameters) {
 	int x, y;
-	Rect aligned_blocks_intersect;
-	Rect bin, bin_intersect;
 	int x_lower, x_upper, y_lower, y_upper;
 	int i;
+	unsigned t, n;
 	Rect bb, prev_bb;
+	Rect TSV_group_bb;
+	vector< array<array<PowerMapBin, POWER_MAPS_DIM>, POWER_MAPS_DIM> > power_maps_delta;
+	double max_diff;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		cout << "-> ThermalAnalyzer::adaptPowerMaps(" << layers << ", " << &TSVs << ", " << &nets << ", " << &parameters << ")" << endl;
 	}
 
-	// consider impact of vertical buses; map TSVs to power maps
+	// initially, or after changes of the TSV groups' or nets' count, all bins are
+	// to be determined
+	if (!this->power_maps_valid || this->TSV_groups_rasterized.size() != TSVs.size()) {
+		this->power_maps_region.setFull();
+		this->TSV_groups_rasterized.assign(TSVs.size(), {Rect(), -1, 0.0});
+	}
+	if (!this->power_maps_valid || this->nets_TSVs_rasterized.size() != nets.size() * (layers - 1)) {
+		this->power_maps_region.setFull();
+		this->nets_TSVs_rasterized.assign(nets.size() * (layers - 1), {Rect(), -1, 0.0});
+	}
+
+	// consider impact of vertical buses; map TSVs to power maps; only groups in
+	// use are considered
 	//
-	// note that local copies of TSVs groups are used in order to not mess with the
+	// note that a local copy of the groups' bb is used in order to not mess with the
 	// actual coordinates of the groups
-	for (TSV_Group TSV_group : TSVs) {
+	for (t = 0; t < TSVs.size(); t++) {
+
+		TSV_Group const& TSV_group = TSVs[t];
+
+		if (!TSV_group.active) {
+			this->memorizeRasterizedRect(this->TSV_groups_rasterized[t], Rect(), -1, 0.0);
+			continue;
+		}
 
 		// offset intersection, i.e., account for padded power maps and related
 		// offset in coordinates
-		TSV_group.bb.ll.x += this->blocks_offset_x;
-		TSV_group.bb.ll.y += this->blocks_offset_y;
-		TSV_group.bb.ur.x += this->blocks_offset_x;
-		TSV_group.bb.ur.y += this->blocks_offset_y;
-
-		// determine index boundaries for offset intersection; based on boundary
-		// of intersection and the covered bins; note that cast to int truncates
-		// toward zero, i.e., performs like floor for positive numbers
-		x_lower = static_cast<int>(TSV_group.bb.ll.x / this->power_maps_dim_x);
-		y_lower = static_cast<int>(TSV_group.bb.ll.y / this->power_maps_dim_y);
-		// +1 in order to efficiently emulate the result of ceil(); limit upper
-		// bound to power-maps dimensions
-		x_upper = min(static_cast<int>(TSV_group.bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-		y_upper = min(static_cast<int>(TSV_group.bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
+		TSV_group_bb = TSV_group.bb;
+		TSV_group_bb.ll.x += this->blocks_offset_x;
+		TSV_group_bb.ll.y += this->blocks_offset_y;
+		TSV_group_bb.ur.x += this->blocks_offset_x;
+		TSV_group_bb.ur.y += this->blocks_offset_y;
 
 		if (ThermalAnalyzer::DBG) {
 			cout << "DBG> TSV group " << TSV_group.id << endl;
-			cout << "DBG>  Affected power-map bins: " << x_lower << "," << y_lower
+			cout << "DBG>  Offset bb: " << TSV_group_bb.ll.x << "," << TSV_group_bb.ll.y
 				<< " to " <<
-				x_upper << "," << y_upper << endl;
+				TSV_group_bb.ur.x << "," << TSV_group_bb.ur.y << endl;
 		}
 
-		// walk power-map bins covering intersection outline; adapt TSV densities
-		for (x = x_lower; x < x_upper; x++) {
-			for (y = y_lower; y < y_upper; y++) {
-
-				// consider full TSV density for fully covered bins
-				if (x_lower < x && x < (x_upper - 1) && y_lower < y && y < (y_upper - 1)) {
-
-					// adapt map on affected layer
-					this->power_maps[TSV_group.layer][x][y].TSV_density += 100.0;
-				}
-				// else consider TSV density according to partial
-				// intersection with current bin
-				else {
-					// determine real coords of map bin
-					bin.ll.x = this->power_maps_bins_ll_x[x];
-					bin.ll.y = this->power_maps_bins_ll_y[y];
-					// note that +1 is guaranteed to be within
-					// bounds of power_maps_bins_ll_x/y (size
-					// = ThermalAnalyzer::POWER_MAPS_DIM + 1);
-					// the related last tuple describes the
-					// upper-right corner coordinates of the
-					// right/top boundary
-					bin.ur.x = this->power_maps_bins_ll_x[x + 1];
-					bin.ur.y = this->power_maps_bins_ll_y[y + 1];
-
-					// determine intersection
-					bin_intersect = Rect::determineIntersection(bin, TSV_group.bb);
-					// normalize to full bin area
-					bin_intersect.area /= this->power_maps_bin_area;
-
-					// adapt map on affected layer
-					this->power_maps[TSV_group.layer][x][y].TSV_density += 100.0 * bin_intersect.area;
-				}
-			}
-		}
+		// full TSV density on affected layer; for partially covered bins,
+		// the TSV density is considered according to the intersection
+		this->memorizeRasterizedRect(this->TSV_groups_rasterized[t], TSV_group_bb, TSV_group.layer, 100.0);
 	}
 
 	// TODO drop later on; considered in TSV_Group after net clustering is added
@@ -413,26 +379,34 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 	// apply superposition for all TSVs
 
 	// determine TSV impact for each net
-	for (Net const& cur_net : nets) {
+	for (n = 0; n < nets.size(); n++) {
+
+		Net const& cur_net = nets[n];
 
 		if (ThermalAnalyzer::DBG) {
 			cout << "DBG> Determining impact of net " << cur_net.id << endl;
 		}
 
-		// set layer boundaries, i.e., determine lowest and uppermost layer of
-		// net's blocks
-		cur_net.setLayerBoundaries();
-
-		// determine TSV's bounding box on each related layer separately; ignore
+		// consider TSV's bounding box on each related layer separately; ignore
 		// net's uppermost layer since no TSV connects further up from this last
-		// layer
-		for (i = 0; i < cur_net.layer_top; i++) {
+		// layer; note that the layer boundaries and bounding boxes are
+		// determined and cached during interconnects evaluation, see
+		// Net::determBoundingBoxes
+		for (i = 0; i < layers - 1; i++) {
+
+			RasterizedRect& TSVs_rasterized = this->nets_TSVs_rasterized[n * (layers - 1) + i];
+
+			// no TSVs above net's uppermost layer
+			if (i >= cur_net.layer_top) {
+				this->memorizeRasterizedRect(TSVs_rasterized, Rect(), -1, 0.0);
+				continue;
+			}
 
 			prev_bb = bb;
-			bb = cur_net.determBoundingBox(i);
+			bb = cur_net.bb[i];
 
 			// in case the bb on the current layer is zero, reuse the bb from
-			// the layer below (this arises from Net::determBoundingBox being
+			// the layer below (this arises from Net::determBoundingBoxes being
 			// coded for HPWL calculation, where a layer in between with no
 			// blocks should not increase HPWL, but is required to account for
 			// TSV placement)
@@ -442,6 +416,7 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 			// if the bb is still zero, then the first block of the net is
 			// placed in some upper layer
 			if (bb.area == 0.0) {
+				this->memorizeRasterizedRect(TSVs_rasterized, Rect(), -1, 0.0);
 				continue;
 			}
 
@@ -458,33 +433,14 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 			bb.ur.x += this->blocks_offset_x;
 			bb.ur.y += this->blocks_offset_y;
 
-			// determine index boundaries for offset bb; based on boundary of
-			// intersection and the covered bins; note that cast to int
-			// truncates toward zero, i.e., performs like floor for positive
-			// numbers
-			x_lower = static_cast<int>(bb.ll.x / this->power_maps_dim_x);
-			y_lower = static_cast<int>(bb.ll.y / this->power_maps_dim_y);
-			// +1 in order to efficiently emulate the result of ceil(); limit
-			// upper bound to power-maps dimensions
-			x_upper = min(static_cast<int>(bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-			y_upper = min(static_cast<int>(bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
-
-			// walk power-map bins covering bb outline; adapt TSV densities;
-			// don't care about particular amount of coverage b/w bb and map
-			// bins, since the density of a single TSV is quite small
-			// only consider fully covered bins
-			for (x = x_lower; x < x_upper; x++) {
-				for (y = y_lower; y < y_upper; y++) {
-
-					// spread out the impact of this TSV across its
-					// bb; consider TSV pitch since 100% TSV density
-					// equals to closely packed TSVs, i.e., only w/
-					// pitch distance between each other
-					this->power_maps[i][x][y].TSV_density += 100.0 * (pow(TSV_pitch, 2) / bb.area);
-				}
-			}
+			// spread out the impact of this TSV across its bb; consider TSV
+			// pitch since 100% TSV density equals to closely packed TSVs,
+			// i.e., only w/ pitch distance between each other
+			this->memorizeRasterizedRect(TSVs_rasterized, bb, i, 100.0 * (pow(TSV_pitch, 2) / bb.area));
 
 			if (ThermalAnalyzer::DBG) {
+				this->determNetTSVsBins(bb, x_lower, x_upper, y_lower, y_upper);
+
 				cout << "DBG>   additional TSV density for each bin: " <<
 					100.0 * (pow(TSV_pitch, 2) / bb.area) << endl;
 				cout << "DBG>   affected power-map bins: " << x_lower << "," << y_lower
@@ -494,9 +450,204 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 		}
 	}
 
-	// walk power-map bins; adapt power according to TSV densities
-	for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
-		for (y = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+	// update power maps for region of changed bins
+	if (!this->power_maps_region.empty()) {
+
+		this->updatePowerMaps(layers, parameters, this->power_maps_region);
+
+		// sanity check; compare to power maps fully determined again
+		if (ThermalAnalyzer::DBG_DELTA) {
+			Region full;
+			full.setFull();
+			max_diff = 0.0;
+
+			power_maps_delta = this->power_maps;
+			this->updatePowerMaps(layers, parameters, full);
+
+			for (i = 0; i < layers; i++) {
+				for (x = 0; x < ThermalAnalyzer::POWER_MAPS_DIM; x++) {
+					for (y = 0; y < ThermalAnalyzer::POWER_MAPS_DIM; y++) {
+						max_diff = max(max_diff, abs(power_maps_delta[i][x][y].power_density - this->power_maps[i][x][y].power_density));
+						max_diff = max(max_diff, abs(power_maps_delta[i][x][y].TSV_density - this->power_maps[i][x][y].TSV_density));
+					}
+				}
+			}
+
+			if (max_diff > 1.0e-9) {
+				cout << "DBG_DELTA> Update of power maps differs from full update; max diff: " << max_diff << endl;
+			}
+		}
+	}
+
+	this->power_maps_valid = true;
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		cout << "<- ThermalAnalyzer::adaptPowerMaps" << endl;
+	}
+}
+
+// Memorize rasterized rect; in case it differs from the previously memorized one, the
+// region of changed bins is extended by both
+void ThermalAnalyzer::memorizeRasterizedRect(RasterizedRect& memorized, Rect const& bb, int const& layer, double const& value) {
+	int x_lower, x_upper, y_lower, y_upper;
+
+	if (
+			memorized.layer == layer && memorized.value == value
+			&& memorized.bb.ll.x == bb.ll.x && memorized.bb.ll.y == bb.ll.y
+			&& memorized.bb.ur.x == bb.ur.x && memorized.bb.ur.y == bb.ur.y
+	   ) {
+		return;
+	}
+
+	// note that the bins derived for nets' TSVs cover all bins affected by a
+	// fractionally rasterized rect as well
+	if (memorized.value != 0.0) {
+		this->determNetTSVsBins(memorized.bb, x_lower, x_upper, y_lower, y_upper);
+		this->power_maps_region.extend(x_lower, x_upper, y_lower, y_upper);
+	}
+	if (value != 0.0) {
+		this->determNetTSVsBins(bb, x_lower, x_upper, y_lower, y_upper);
+		this->power_maps_region.extend(x_lower, x_upper, y_lower, y_upper);
+	}
+
+	memorized.bb = bb;
+	memorized.layer = layer;
+	memorized.value = value;
+}
+
+// Determine index boundaries for offset bb of net's TSVs; based on boundary of bb and
+// the covered bins
+void ThermalAnalyzer::determNetTSVsBins(Rect const& bb, int& x_lower, int& x_upper, int& y_lower, int& y_upper) const {
+
+	// note that cast to int truncates toward zero, i.e., performs like floor for
+	// positive numbers
+	x_lower = static_cast<int>(bb.ll.x / this->power_maps_dim_x);
+	y_lower = static_cast<int>(bb.ll.y / this->power_maps_dim_y);
+	// +1 in order to efficiently emulate the result of ceil(); limit upper bound
+	// to power-maps dimensions
+	x_upper = min(static_cast<int>(bb.ur.x / this->power_maps_dim_x) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
+	y_upper = min(static_cast<int>(bb.ur.y / this->power_maps_dim_y) + 1, ThermalAnalyzer::POWER_MAPS_DIM);
+}
+
+// Determine power maps for region of bins, based on the memorized blocks, TSV groups
+// and nets' TSVs; the bins outside the region remain as is
+void ThermalAnalyzer::updatePowerMaps(int const& layers, MaskParameters const& parameters, Region const& region) {
+	int i;
+	int x, y;
+	int x_lower, x_upper, y_lower, y_upper;
+	bool padding_zone;
+
+	// reset difference maps for region
+	for (i = 0; i < layers; i++) {
+		ThermalAnalyzer::resetDiffMap(this->power_maps_diff[i], region);
+	}
+
+	// rasterize each block into the difference map of the related layer;
+	// fractional coverage of bins at the block's boundaries is considered;
+	// only the block's part w/in the region is rasterized
+	for (RasterizedRect const& block : this->blocks_rasterized) {
+
+		if (block.value == 0.0) {
+			continue;
+		}
+
+		this->rasterizeRect(this->power_maps_diff[block.layer], block.bb, block.value, region);
+	}
+
+	// determine maps for each layer
+	for (i = 0; i < layers; i++) {
+
+		// derive actual power densities from difference map
+		ThermalAnalyzer::integrateDiffMap(this->power_maps_diff[i], region);
+
+		for (x = region.x_lower; x < region.x_upper; x++) {
+			for (y = region.y_lower; y < region.y_upper; y++) {
+
+				// determine if bin w/in padding zone
+				if (
+						x < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+						|| x >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+						|| y < ThermalAnalyzer::POWER_MAPS_PADDED_BINS
+						|| y >= (ThermalAnalyzer::POWER_MAPS_DIM - ThermalAnalyzer::POWER_MAPS_PADDED_BINS)
+				   ) {
+					padding_zone = true;
+				}
+				else {
+					padding_zone = false;
+				}
+
+				// note that this also implicitly pads the map w/ zero power
+				// density
+				if (padding_zone) {
+					this->power_maps[i][x][y].power_density = this->power_maps_diff[i][x][y] * parameters.power_density_scaling_padding_zone;
+				}
+				else {
+					this->power_maps[i][x][y].power_density = this->power_maps_diff[i][x][y];
+				}
+			}
+		}
+	}
+
+	// TSV densities are rasterized into difference maps as well, reset them first
+	for (i = 0; i < layers; i++) {
+		ThermalAnalyzer::resetDiffMap(this->power_maps_diff[i], region);
+	}
+
+	// rasterize full TSV density of groups on affected layer
+	for (RasterizedRect const& TSV_group : this->TSV_groups_rasterized) {
+
+		if (TSV_group.value == 0.0) {
+			continue;
+		}
+
+		this->rasterizeRect(this->power_maps_diff[TSV_group.layer], TSV_group.bb, TSV_group.value, region);
+	}
+
+	// rasterize power-map bins covering nets' TSVs' bb; don't care about
+	// particular amount of coverage b/w bb and map bins, since the density of a
+	// single TSV is quite small
+	for (RasterizedRect const& TSVs : this->nets_TSVs_rasterized) {
+
+		if (TSVs.value == 0.0) {
+			continue;
+		}
+
+		this->determNetTSVsBins(TSVs.bb, x_lower, x_upper, y_lower, y_upper);
+
+		// limit to region; note that bb may be outside the power maps for
+		// layouts not fitting into the die outline; ignore such bb
+		x_lower = max(x_lower, region.x_lower);
+		x_upper = min(x_upper, region.x_upper);
+		y_lower = max(y_lower, region.y_lower);
+		y_upper = min(y_upper, region.y_upper);
+		if (x_lower >= x_upper || y_lower >= y_upper) {
+			continue;
+		}
+
+		ThermalAnalyzer::rasterizeBins(this->power_maps_diff[TSVs.layer], x_lower, x_upper, y_lower, y_upper, TSVs.value);
+	}
+
+	// derive actual TSV densities from difference maps
+	for (i = 0; i < layers; i++) {
+
+		ThermalAnalyzer::integrateDiffMap(this->power_maps_diff[i], region);
+
+		for (x = region.x_lower; x < region.x_upper; x++) {
+			for (y = region.y_lower; y < region.y_upper; y++) {
+				this->power_maps[i][x][y].TSV_density = this->power_maps_diff[i][x][y];
+			}
+		}
+	}
+
+	// walk power-map bins of region w/in thermal map; adapt power according to TSV
+	// densities
+	x_lower = max(region.x_lower, ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+	x_upper = min(region.x_upper, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+	y_lower = max(region.y_lower, ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+	y_upper = min(region.y_upper, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+
+	for (x = x_lower; x < x_upper; x++) {
+		for (y = y_lower; y < y_upper; y++) {
 
 			// sanity check; TSV density should be <= 100%; might be larger
 			// due to superposition in calculations above
@@ -515,9 +666,128 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 			}
 		}
 	}
+}
 
-	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "<- ThermalAnalyzer::adaptPowerMaps" << endl;
+// Rasterization of rectangles into power maps, based on 2D difference arrays. The
+// coverage of bins by a rectangle is separable into the bins' coverage in x- and
+// y-dimension; each dimension provides up to three segments of bins w/ equal
+// coverage, i.e., partially covered bins at the boundaries and fully covered bins in
+// between. Thus, each rectangle only requires constant corner updates of the
+// difference map; the actual map values are obtained by a subsequent prefix-sum pass,
+// see integrateDiffMap(). Only the rectangle's part w/in the region is rasterized
+void ThermalAnalyzer::rasterizeRect(DiffMap& diff_map, Rect const& rect, double const& value, Region const& region) const {
+	array<BinsSegment,3> x_segments, y_segments;
+	int x_segments_count, y_segments_count;
+	int x, y;
+
+	// determine bins' coverage in terms of bin dimensions
+	x_segments_count = ThermalAnalyzer::determBinsCoverage(x_segments, rect.ll.x / this->power_maps_dim_x, rect.ur.x / this->power_maps_dim_x,
+			region.x_lower, region.x_upper);
+	y_segments_count = ThermalAnalyzer::determBinsCoverage(y_segments, rect.ll.y / this->power_maps_dim_y, rect.ur.y / this->power_maps_dim_y,
+			region.y_lower, region.y_upper);
+
+	for (x = 0; x < x_segments_count; x++) {
+		for (y = 0; y < y_segments_count; y++) {
+
+			ThermalAnalyzer::rasterizeBins(diff_map,
+					x_segments[x].first, x_segments[x].last + 1,
+					y_segments[y].first, y_segments[y].last + 1,
+					value * x_segments[x].coverage * y_segments[y].coverage);
+		}
+	}
+}
+
+// Determine segments of bins covered by interval [lower, upper), given in terms of bin
+// dimensions and limited to the bins [limit_lower, limit_upper); returns count of
+// segments
+int ThermalAnalyzer::determBinsCoverage(array<BinsSegment,3>& segments, double lower, double upper, int const& limit_lower, int const& limit_upper) {
+	int first, last;
+	int count;
+
+	// limit to given bins
+	lower = max(lower, static_cast<double>(limit_lower));
+	upper = min(upper, static_cast<double>(limit_upper));
+
+	if (upper <= lower) {
+		return 0;
+	}
+
+	// note that cast to int truncates toward zero, i.e., performs like floor for
+	// positive numbers
+	first = static_cast<int>(lower);
+	last = static_cast<int>(ceil(upper)) - 1;
+
+	// interval covers only one bin
+	if (first == last) {
+		segments[0] = {first, first, upper - lower};
+		return 1;
+	}
+
+	count = 0;
+	// partially covered lower bin
+	segments[count++] = {first, first, (first + 1) - lower};
+	// fully covered bins
+	if (last - first > 1) {
+		segments[count++] = {first + 1, last - 1, 1.0};
+	}
+	// partially covered upper bin
+	segments[count++] = {last, last, upper - last};
+
+	return count;
+}
+
+// Add value to all bins [x_lower, x_upper) x [y_lower, y_upper) of the difference map
+void ThermalAnalyzer::rasterizeBins(DiffMap& diff_map, int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper, double const& value) {
+
+	diff_map[x_lower][y_lower] += value;
+	diff_map[x_upper][y_lower] -= value;
+	diff_map[x_lower][y_upper] -= value;
+	diff_map[x_upper][y_upper] += value;
+}
+
+// Reset difference map for region; also for the upper/right boundaries, which capture
+// updates of rasterized rects ending there
+void ThermalAnalyzer::resetDiffMap(DiffMap& diff_map, Region const& region) {
+	int x;
+
+	for (x = region.x_lower; x <= region.x_upper; x++) {
+		fill(diff_map[x].begin() + region.y_lower, diff_map[x].begin() + region.y_upper + 1, 0.0);
+	}
+}
+
+// Prefix-sum pass over the region of the difference map; afterwards, the region
+// contains the actual bin values. The prefix sums leave rounding noise in bins w/o
+// any rasterized value, i.e., tiny positive or negative values; since all rasterized
+// values are positive, such noise is reset to zero
+void ThermalAnalyzer::integrateDiffMap(DiffMap& diff_map, Region const& region) {
+	int x, y;
+	double noise;
+
+	// the noise is relative to the largest update of the difference map
+	noise = 0.0;
+	for (x = region.x_lower; x < region.x_upper; x++) {
+		noise = max(noise, abs(diff_map[x][region.y_lower]));
+
+		for (y = region.y_lower + 1; y < region.y_upper; y++) {
+			noise = max(noise, abs(diff_map[x][y]));
+
+			diff_map[x][y] += diff_map[x][y - 1];
+		}
+	}
+	noise *= ThermalAnalyzer::RASTERIZATION_NOISE_TOLERANCE;
+
+	for (x = region.x_lower + 1; x < region.x_upper; x++) {
+		for (y = region.y_lower; y < region.y_upper; y++) {
+			diff_map[x][y] += diff_map[x - 1][y];
+		}
+	}
+
+	for (x = region.x_lower; x < region.x_upper; x++) {
+		for (y = region.y_lower; y < region.y_upper; y++) {
+			if (diff_map[x][y] < noise) {
+				diff_map[x][y] = 0.0;
+			}
+		}
 	}
 }
 
@@ -527,33 +797,542 @@ void ThermalAnalyzer::adaptPowerMaps(int const& layers, vector<TSV_Group> const&
 // Returns cost (max * avg temp estimate) of thermal map of lowest layer, i.e., hottest layer
 // Based on http://www.songho.ca/dsp/convolution/convolution.html#separable_convolution
 void ThermalAnalyzer::performPowerBlurring(Temp& ret, int const& layers, MaskParameters const& parameters) {
-	int layer;
-	int x, y, i;
-	int map_x, map_y;
-	int mask_i;
 	double max_temp, avg_temp;
-	// required as buffer for separated convolution; note that its dimensions
-	// corresponds to a power map, which is required to hold temporary results for 1D
-	// convolution of padded power maps
-	array<array<double,ThermalAnalyzer::POWER_MAPS_DIM>,ThermalAnalyzer::POWER_MAPS_DIM> thermal_map_tmp;
 
 	if (ThermalAnalyzer::DBG_CALLS) {
 		cout << "-> ThermalAnalyzer::performPowerBlurring(" << &ret << ", " << ", " << layers << ", " << &parameters << ")" << endl;
 	}
 
-	// init temp map w/ zero
-	for (auto& m : thermal_map_tmp) {
-		m.fill(0.0);
+	/// perform 2D convolution by performing two separated 1D convolution iterations;
+	/// in case all thermal masks share the same shape, the layers' power maps are
+	/// collapsed beforehand and only one convolution is required; this also
+	/// enables delta updates of the thermal map
+	if (this->thermal_masks_collapsible) {
+		this->blurPowerMapsCollapsed(layers, parameters);
+	}
+	else {
+		// init temp map w/ zero
+		for (auto& m : this->thermal_map_tmp) {
+			m.fill(0.0);
+		}
+
+		this->initThermalMap(parameters);
+		this->blurPowerMapsPerLayer(layers);
 	}
 
-	// Init final map w/ temperature offset; temperature offset is expected to be
-	// equal for all cases, i.e., independent of TSV density / assuming zero TSVs;
-	// this is required for resonable values w/o gaps at boundary bins w/ different
-	// thermal masks. Note that temperature offset is a additive factor, and thus not
-	// considered during convolution.
+	// the power maps' changes are considered now
+	this->power_maps_region.reset();
+
+	// determine max and avg value
+	this->determMaxAvgTemp(max_temp, avg_temp);
+
+	// determine cost: max temp estimation, weighted w/ avg temp
+	ret.cost_temp = avg_temp * max_temp;
+	// store max temp
+	ret.max_temp = max_temp;
+
+	if (ThermalAnalyzer::DBG_CALLS) {
+		cout << "<- ThermalAnalyzer::performPowerBlurring" << endl;
+	}
+}
+
+// Init final map w/ temperature offset; temperature offset is expected to be equal
+// for all cases, i.e., independent of TSV density / assuming zero TSVs; this is
+// required for resonable values w/o gaps at boundary bins w/ different thermal masks.
+// Note that temperature offset is a additive factor, and thus not considered during
+// convolution.
+void ThermalAnalyzer::initThermalMap(MaskParameters const& parameters) {
+
 	for (auto& m : this->thermal_map) {
 		m.fill(parameters.temp_offset);
 	}
+}
+
+// Separated convolution on collapsed power maps. Since all thermal masks share the
+// same shape, i.e., mask[layer] = amplitude[layer] * mask[0], the horizontal
+// convolution of all layers equals the convolution of the amplitude-weighted sum
+// of the power maps w/ mask[0]; similarly, the vertical convolution w/ all layers'
+// masks equals the convolution w/ mask[0], scaled by the sum of all amplitudes.
+//
+// Since the convolution is linear, the thermal map can also be updated by convoluting
+// only the difference of the current and the previous collapsed power map; this is
+// limited to the region covering all changed bins. The power maps are only changed
+// w/in the region covered by changed blocks and TSVs, see adaptPowerMaps, i.e., only
+// this region is to be collapsed and compared. For large regions, and periodically in
+// order to not accumulate rounding errors, the full map is convoluted instead.
+void ThermalAnalyzer::blurPowerMapsCollapsed(int const& layers, MaskParameters const& parameters) {
+	int layer;
+	int x, y;
+	double bin;
+	double tolerance;
+	int x_lower, x_upper, y_lower, y_upper;
+	int map_x_lower, map_x_upper, map_y_lower, map_y_upper;
+	bool delta_update;
+
+	// collapse power maps w/in region of changed power-map bins, determine
+	// difference to previous collapsed map and the region of bins which actually
+	// changed; differences w/in the tolerance are neither considered nor
+	// memorized
+	tolerance = ThermalAnalyzer::DELTA_UPDATE_TOLERANCE * this->power_density_max;
+
+	x_lower = y_lower = ThermalAnalyzer::POWER_MAPS_DIM;
+	x_upper = y_upper = 0;
+
+	for (x = this->power_maps_region.x_lower; x < this->power_maps_region.x_upper; x++) {
+		for (y = this->power_maps_region.y_lower; y < this->power_maps_region.y_upper; y++) {
+
+			bin = this->power_maps[0][x][y].power_density;
+
+			for (layer = 1; layer < layers; layer++) {
+				bin += this->power_maps[layer][x][y].power_density *
+					this->thermal_masks_amplitudes[layer];
+			}
+
+			if (abs(bin - this->power_map_collapsed[x][y]) > tolerance) {
+
+				this->power_map_delta[x][y] = bin - this->power_map_collapsed[x][y];
+				this->power_map_collapsed[x][y] = bin;
+
+				x_lower = min(x_lower, x);
+				x_upper = max(x_upper, x + 1);
+				y_lower = min(y_lower, y);
+				y_upper = max(y_upper, y + 1);
+			}
+			else {
+				this->power_map_delta[x][y] = 0.0;
+			}
+		}
+	}
+
+	// determine region of thermal map affected by changed bins; i.e., extend the
+	// region by the mask's range and limit to the thermal map (in terms of the
+	// padded power-map coordinates)
+	map_x_lower = max(x_lower - ThermalAnalyzer::THERMAL_MASK_CENTER, ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+	map_x_upper = min(x_upper + ThermalAnalyzer::THERMAL_MASK_CENTER, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+	map_y_lower = max(y_lower - ThermalAnalyzer::THERMAL_MASK_CENTER, ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+	map_y_upper = min(y_upper + ThermalAnalyzer::THERMAL_MASK_CENTER, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+
+	delta_update = this->thermal_map_valid
+		&& this->thermal_map_delta_updates < ThermalAnalyzer::DELTA_UPDATES_LIMIT
+		&& (max(0, map_x_upper - map_x_lower) * max(0, map_y_upper - map_y_lower))
+			<= ThermalAnalyzer::DELTA_UPDATE_AREA_LIMIT * pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+
+	if (ThermalAnalyzer::DBG) {
+		cout << "DBG> Power blurring; changed power-map bins: " << x_lower << "," << y_lower << " to " << x_upper << "," << y_upper;
+		cout << "; delta update: " << delta_update << endl;
+	}
+
+	// delta update; thermal map remains as is for no changed bins
+	if (delta_update) {
+
+		if (x_lower < x_upper) {
+
+			// reset temp map, only for the bins considered during vertical
+			// convolution below; the changed bins' rows are extended by the
+			// mask's range
+			for (x = map_x_lower; x < map_x_upper; x++) {
+				fill(this->thermal_map_tmp[x].begin() + (map_y_lower - ThermalAnalyzer::THERMAL_MASK_CENTER),
+						this->thermal_map_tmp[x].begin() + (map_y_upper + ThermalAnalyzer::THERMAL_MASK_CENTER), 0.0);
+			}
+
+			// horizontal convolution of difference map; only for the changed
+			// bins' rows, but for all columns affected by the mask
+			ThermalAnalyzer::convoluteHorizontal(this->power_map_delta, this->thermal_masks[0], this->thermal_map_tmp,
+					map_x_lower, map_x_upper, y_lower, y_upper);
+			// vertical convolution of temp map, accumulated into thermal map
+			this->convoluteVertical(this->thermal_map_tmp, this->thermal_masks[0], this->thermal_masks_amplitudes_sum,
+					map_x_lower, map_x_upper, map_y_lower, map_y_upper);
+		}
+
+		this->thermal_map_delta_updates++;
+
+		// sanity check; compare to full convolution
+		if (ThermalAnalyzer::DBG_DELTA) {
+			array<array<double,ThermalAnalyzer::THERMAL_MAP_DIM>,ThermalAnalyzer::THERMAL_MAP_DIM> thermal_map_delta = this->thermal_map;
+			double max_diff = 0.0;
+
+			for (auto& m : this->thermal_map_tmp) {
+				m.fill(0.0);
+			}
+			this->initThermalMap(parameters);
+			ThermalAnalyzer::convoluteHorizontal(this->power_map_collapsed, this->thermal_masks[0], this->thermal_map_tmp,
+					ThermalAnalyzer::POWER_MAPS_PADDED_BINS, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS,
+					0, ThermalAnalyzer::POWER_MAPS_DIM);
+			this->convoluteVertical(this->thermal_map_tmp, this->thermal_masks[0], this->thermal_masks_amplitudes_sum,
+					ThermalAnalyzer::POWER_MAPS_PADDED_BINS, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS,
+					ThermalAnalyzer::POWER_MAPS_PADDED_BINS, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+
+			for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+				for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+					max_diff = max(max_diff, abs(thermal_map_delta[x][y] - this->thermal_map[x][y]));
+				}
+			}
+
+			if (max_diff > 1.0e-6) {
+				cout << "DBG_DELTA> Delta update of thermal map differs from full convolution; max diff: " << max_diff << endl;
+			}
+		}
+	}
+	// full convolution
+	else {
+		this->initThermalMap(parameters);
+
+		// reset temp map, only for the rows considered during convolution
+		for (x = ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x < ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS; x++) {
+			this->thermal_map_tmp[x].fill(0.0);
+		}
+
+		// horizontal convolution of collapsed map, vertical convolution of temp
+		// map; for the latter, scale once by the sum of all masks' amplitudes
+		ThermalAnalyzer::convoluteHorizontal(this->power_map_collapsed, this->thermal_masks[0], this->thermal_map_tmp,
+				ThermalAnalyzer::POWER_MAPS_PADDED_BINS, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS,
+				0, ThermalAnalyzer::POWER_MAPS_DIM);
+		this->convoluteVertical(this->thermal_map_tmp, this->thermal_masks[0], this->thermal_masks_amplitudes_sum,
+				ThermalAnalyzer::POWER_MAPS_PADDED_BINS, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS,
+				ThermalAnalyzer::POWER_MAPS_PADDED_BINS, ThermalAnalyzer::THERMAL_MAP_DIM + ThermalAnalyzer::POWER_MAPS_PADDED_BINS);
+
+		this->thermal_map_valid = true;
+		this->thermal_map_delta_updates = 0;
+	}
+
+	// reset difference map w/in region; the horizontal convolution of the next
+	// delta update also considers bins outside the next region, which are thus
+	// to be zero
+	for (x = this->power_maps_region.x_lower; x < this->power_maps_region.x_upper; x++) {
+		fill(this->power_map_delta[x].begin() + this->power_maps_region.y_lower,
+				this->power_map_delta[x].begin() + this->power_maps_region.y_upper, 0.0);
+	}
+}
+
+// Select convolution kernels; the best SIMD implementation supported by the CPU,
+// the scalar implementation otherwise
+ThermalAnalyzer::Kernels ThermalAnalyzer::selectKernels() {
+	ThermalAnalyzer::Kernels kernels;
+
+	kernels.convoluteHorizontal = &ThermalAnalyzer::convoluteHorizontalScalar;
+	kernels.convoluteVertical = &ThermalAnalyzer::convoluteVerticalScalar;
+	kernels.determMaxAvgTemp = &ThermalAnalyzer::determMaxAvgTempScalar;
+
+#if defined(__x86_64__) || defined(__i386__)
+	if (ThermalAnalyzer::DBG_SCALAR) {
+	}
+	else if (__builtin_cpu_supports("avx512f")) {
+		kernels.convoluteHorizontal = &ThermalAnalyzer::convoluteHorizontalAVX512;
+		kernels.convoluteVertical = &ThermalAnalyzer::convoluteVerticalAVX512;
+		kernels.determMaxAvgTemp = &ThermalAnalyzer::determMaxAvgTempAVX512;
+	}
+	else if (__builtin_cpu_supports("avx2")) {
+		kernels.convoluteHorizontal = &ThermalAnalyzer::convoluteHorizontalAVX2;
+		kernels.convoluteVertical = &ThermalAnalyzer::convoluteVerticalAVX2;
+		kernels.determMaxAvgTemp = &ThermalAnalyzer::determMaxAvgTempAVX2;
+	}
+#endif
+
+	return kernels;
+}
+
+// Horizontal 1D convolution of (padded) input map w/ mask, accumulated into output.
+// For full convolutions, the same ranges as for the per-layer convolution are to be
+// considered, see blurPowerMapsPerLayer(), i.e., the full y-dimension and the
+// x-dimension restricted to the thermal map
+void ThermalAnalyzer::convoluteHorizontalScalar(TempMap const& input, Mask const& mask, TempMap& output,
+		int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+	int x, y;
+	int mask_i;
+	double* out;
+	double const* in;
+
+	for (x = x_lower; x < x_upper; x++) {
+
+		out = output[x].data();
+
+		for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+
+			// input column; note that it is not out of range due to the
+			// padded input map
+			in = input[x + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER)].data();
+
+			for (y = y_lower; y < y_upper; y++) {
+				out[y] += in[y] * mask[mask_i];
+			}
+		}
+	}
+}
+
+// Vertical 1D convolution of (padded) temp map w/ mask, scaled and accumulated into
+// final thermal map. Ranges are given in terms of the padded map, and must be limited
+// to the thermal map
+void ThermalAnalyzer::convoluteVerticalScalar(TempMap const& input, Mask const& mask, double const& scale, ThermalMap& output,
+		int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+	int x, y;
+	int mask_i;
+	double* out;
+	double const* in;
+	double conv;
+
+	for (x = x_lower; x < x_upper; x++) {
+
+		// final thermal map doesn't consider the padding offset; the input
+		// bin i = y + (mask_i - THERMAL_MASK_CENTER) for thermal-map bin y -
+		// POWER_MAPS_PADDED_BINS thus simplifies to in[y + mask_i] for
+		// thermal-map bin y
+		out = output[x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS].data();
+		in = input[x].data();
+
+		for (y = y_lower - ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y < y_upper - ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+
+			conv = 0.0;
+			for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+				conv += in[y + mask_i] * mask[mask_i];
+			}
+
+			out[y] += conv * scale;
+		}
+	}
+}
+
+// Determine max and avg value of thermal map
+void ThermalAnalyzer::determMaxAvgTempScalar(ThermalMap const& map, double& max_temp, double& avg_temp) {
+	int x, y;
+
+	max_temp = avg_temp = 0.0;
+
+	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			max_temp = max(max_temp, map[x][y]);
+			avg_temp += map[x][y];
+		}
+	}
+
+	avg_temp /= pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// SIMD implementations of the kernels above; the bins in y-dimension are contiguous in
+// memory, thus they are processed in SIMD vectors. Note that each bin accumulates the
+// mask products in the same order as for the scalar code, i.e., the convolution
+// results are equal; the SIMD vectors for max and avg value are reduced at the very
+// end, by storing and reducing them element-wise
+__attribute__((target("avx2")))
+void ThermalAnalyzer::convoluteHorizontalAVX2(TempMap const& input, Mask const& mask, TempMap& output,
+		int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+	int x, y;
+	int mask_i;
+	double* out;
+	double const* in;
+
+	for (x = x_lower; x < x_upper; x++) {
+
+		out = output[x].data();
+
+		for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+
+			in = input[x + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER)].data();
+
+			y = y_lower;
+			__m256d m4 = _mm256_set1_pd(mask[mask_i]);
+			for (; y + 4 <= y_upper; y += 4) {
+				_mm256_storeu_pd(out + y, _mm256_add_pd(_mm256_loadu_pd(out + y), _mm256_mul_pd(_mm256_loadu_pd(in + y), m4)));
+			}
+			// scalar fallback for remaining bins
+			for (; y < y_upper; y++) {
+				out[y] += in[y] * mask[mask_i];
+			}
+		}
+	}
+}
+
+__attribute__((target("avx2")))
+void ThermalAnalyzer::convoluteVerticalAVX2(TempMap const& input, Mask const& mask, double const& scale, ThermalMap& output,
+		int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+	int x, y;
+	int mask_i;
+	double* out;
+	double const* in;
+	double conv;
+
+	__m256d scale4 = _mm256_set1_pd(scale);
+
+	for (x = x_lower; x < x_upper; x++) {
+
+		out = output[x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS].data();
+		in = input[x].data();
+
+		y = y_lower - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+		for (; y + 4 <= y_upper - ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y += 4) {
+			__m256d conv4 = _mm256_setzero_pd();
+			for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+				conv4 = _mm256_add_pd(conv4, _mm256_mul_pd(_mm256_loadu_pd(in + y + mask_i), _mm256_set1_pd(mask[mask_i])));
+			}
+			_mm256_storeu_pd(out + y, _mm256_add_pd(_mm256_loadu_pd(out + y), _mm256_mul_pd(conv4, scale4)));
+		}
+		// scalar fallback for remaining bins
+		for (; y < y_upper - ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+
+			conv = 0.0;
+			for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+				conv += in[y + mask_i] * mask[mask_i];
+			}
+
+			out[y] += conv * scale;
+		}
+	}
+}
+
+__attribute__((target("avx2")))
+void ThermalAnalyzer::determMaxAvgTempAVX2(ThermalMap const& map, double& max_temp, double& avg_temp) {
+	int x, y;
+	double const* row;
+	array<double,4> max4_, sum4_;
+
+	__m256d max4 = _mm256_setzero_pd();
+	__m256d sum4 = _mm256_setzero_pd();
+
+	max_temp = avg_temp = 0.0;
+
+	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+
+		row = map[x].data();
+
+		y = 0;
+		for (; y + 4 <= ThermalAnalyzer::THERMAL_MAP_DIM; y += 4) {
+			max4 = _mm256_max_pd(max4, _mm256_loadu_pd(row + y));
+			sum4 = _mm256_add_pd(sum4, _mm256_loadu_pd(row + y));
+		}
+		// scalar fallback for remaining bins
+		for (; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			max_temp = max(max_temp, row[y]);
+			avg_temp += row[y];
+		}
+	}
+
+	// reduce SIMD vectors
+	_mm256_storeu_pd(max4_.data(), max4);
+	_mm256_storeu_pd(sum4_.data(), sum4);
+	for (y = 0; y < 4; y++) {
+		max_temp = max(max_temp, max4_[y]);
+		avg_temp += sum4_[y];
+	}
+
+	avg_temp /= pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+}
+
+__attribute__((target("avx512f")))
+void ThermalAnalyzer::convoluteHorizontalAVX512(TempMap const& input, Mask const& mask, TempMap& output,
+		int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+	int x, y;
+	int mask_i;
+	double* out;
+	double const* in;
+
+	for (x = x_lower; x < x_upper; x++) {
+
+		out = output[x].data();
+
+		for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+
+			in = input[x + (mask_i - ThermalAnalyzer::THERMAL_MASK_CENTER)].data();
+
+			y = y_lower;
+			__m512d m8 = _mm512_set1_pd(mask[mask_i]);
+			for (; y + 8 <= y_upper; y += 8) {
+				_mm512_storeu_pd(out + y, _mm512_add_pd(_mm512_loadu_pd(out + y), _mm512_mul_pd(_mm512_loadu_pd(in + y), m8)));
+			}
+			// scalar fallback for remaining bins
+			for (; y < y_upper; y++) {
+				out[y] += in[y] * mask[mask_i];
+			}
+		}
+	}
+}
+
+__attribute__((target("avx512f")))
+void ThermalAnalyzer::convoluteVerticalAVX512(TempMap const& input, Mask const& mask, double const& scale, ThermalMap& output,
+		int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+	int x, y;
+	int mask_i;
+	double* out;
+	double const* in;
+	double conv;
+
+	__m512d scale8 = _mm512_set1_pd(scale);
+
+	for (x = x_lower; x < x_upper; x++) {
+
+		out = output[x - ThermalAnalyzer::POWER_MAPS_PADDED_BINS].data();
+		in = input[x].data();
+
+		y = y_lower - ThermalAnalyzer::POWER_MAPS_PADDED_BINS;
+		for (; y + 8 <= y_upper - ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y += 8) {
+			__m512d conv8 = _mm512_setzero_pd();
+			for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+				conv8 = _mm512_add_pd(conv8, _mm512_mul_pd(_mm512_loadu_pd(in + y + mask_i), _mm512_set1_pd(mask[mask_i])));
+			}
+			_mm512_storeu_pd(out + y, _mm512_add_pd(_mm512_loadu_pd(out + y), _mm512_mul_pd(conv8, scale8)));
+		}
+		// scalar fallback for remaining bins
+		for (; y < y_upper - ThermalAnalyzer::POWER_MAPS_PADDED_BINS; y++) {
+
+			conv = 0.0;
+			for (mask_i = 0; mask_i < ThermalAnalyzer::THERMAL_MASK_DIM; mask_i++) {
+				conv += in[y + mask_i] * mask[mask_i];
+			}
+
+			out[y] += conv * scale;
+		}
+	}
+}
+
+__attribute__((target("avx512f")))
+void ThermalAnalyzer::determMaxAvgTempAVX512(ThermalMap const& map, double& max_temp, double& avg_temp) {
+	int x, y;
+	double const* row;
+	array<double,8> max8_, sum8_;
+
+	__m512d max8 = _mm512_setzero_pd();
+	__m512d sum8 = _mm512_setzero_pd();
+
+	max_temp = avg_temp = 0.0;
+
+	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
+
+		row = map[x].data();
+
+		y = 0;
+		for (; y + 8 <= ThermalAnalyzer::THERMAL_MAP_DIM; y += 8) {
+			// note that the masked variant w/ all lanes selected is
+			// applied; the unmasked variant passes an undefined source
+			// vector internally, which triggers uninitialized-value
+			// warnings for some compilers
+			max8 = _mm512_mask_max_pd(max8, static_cast<__mmask8>(0xFF), max8, _mm512_loadu_pd(row + y));
+			sum8 = _mm512_add_pd(sum8, _mm512_loadu_pd(row + y));
+		}
+		// scalar fallback for remaining bins
+		for (; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
+			max_temp = max(max_temp, row[y]);
+			avg_temp += row[y];
+		}
+	}
+
+	// reduce SIMD vectors
+	_mm512_storeu_pd(max8_.data(), max8);
+	_mm512_storeu_pd(sum8_.data(), sum8);
+	for (y = 0; y < 8; y++) {
+		max_temp = max(max_temp, max8_[y]);
+		avg_temp += sum8_[y];
+	}
+
+	avg_temp /= pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
+}
+#endif
+
+// Separated convolution for each layer, i.e., each power map is convoluted w/ its
+// related thermal mask; fallback for masks w/ differing shapes
+void ThermalAnalyzer::blurPowerMapsPerLayer(int const& layers) {
+	int layer;
+	int x, y, i;
+	int map_x, map_y;
+	int mask_i;
 
 	/// perform 2D convolution by performing two separated 1D convolution iterations;
 	/// note that no (kernel) flipping is required since the mask is symmetric
@@ -609,7 +1388,7 @@ void ThermalAnalyzer::performPowerBlurring(Temp& ret, int const& layers, MaskPar
 
 					// convolution; multiplication of mask element and
 					// power-map bin
-					thermal_map_tmp[x][y] +=
+					this->thermal_map_tmp[x][y] +=
 						this->power_maps[layer][i][y].power_density *
 						this->thermal_masks[layer][mask_i];
 				}
@@ -659,29 +1438,10 @@ void ThermalAnalyzer::performPowerBlurring(Temp& ret, int const& layers, MaskPar
 					// convolution; multiplication of mask element and
 					// power-map bin
 					this->thermal_map[map_x][map_y] +=
-						thermal_map_tmp[x][i] *
+						this->thermal_map_tmp[x][i] *
 						this->thermal_masks[layer][mask_i];
 				}
 			}
 		}
 	}
-
-	// determine max and avg value
-	max_temp = avg_temp = 0.0;
-	for (x = 0; x < ThermalAnalyzer::THERMAL_MAP_DIM; x++) {
-		for (y = 0; y < ThermalAnalyzer::THERMAL_MAP_DIM; y++) {
-			max_temp = max(max_temp, this->thermal_map[x][y]);
-			avg_temp += this->thermal_map[x][y];
-		}
-	}
-	avg_temp /= pow(ThermalAnalyzer::THERMAL_MAP_DIM, 2);
-
-	// determine cost: max temp estimation, weighted w/ avg temp
-	ret.cost_temp = avg_temp * max_temp;
-	// store max temp
-	ret.max_temp = max_temp;
-
-	if (ThermalAnalyzer::DBG_CALLS) {
-		cout << "<- ThermalAnalyzer::performPowerBlurring" << endl;
-	}
 }
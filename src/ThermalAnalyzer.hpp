@@ -38,6 +38,9 @@ class ThermalAnalyzer {
 		static constexpr bool DBG_CALLS = false;
 		static constexpr bool DBG = false;
 		static constexpr bool DBG_INSANE = false;
+		static constexpr bool DBG_DELTA = false;
+		// enforce scalar convolution kernels
+		static constexpr bool DBG_SCALAR = false;
 
 	// PODs, to be declared early on
 	public:
@@ -86,12 +89,106 @@ class ThermalAnalyzer {
 		// considering heat source in layer 1 and so forth.  Note that the masks
 		// are only 1D for the separated convolution.
 		vector< array<double,THERMAL_MASK_DIM> > thermal_masks;
+		// all masks are gauss fcts w/ same spread, i.e., they only differ in
+		// their amplitude; if so, the layers' power maps can be collapsed into
+		// one amplitude-weighted map, which is then convoluted only once;
+		// amplitudes are relative to the mask of layer 0
+		bool thermal_masks_collapsible;
+		vector<double> thermal_masks_amplitudes;
+		double thermal_masks_amplitudes_sum;
+		static constexpr double THERMAL_MASKS_SHAPE_TOLERANCE = 1.0e-9;
 		// power_maps[i][x][y], whereas power_maps[0] relates to the map for layer
 		// 0 and so forth.
 		vector< array<array<PowerMapBin, POWER_MAPS_DIM>, POWER_MAPS_DIM> > power_maps;
 		// thermal map for layer 0 (lowest layer), i.e., hottest layer
 		array<array<double,THERMAL_MAP_DIM>,THERMAL_MAP_DIM> thermal_map;
 
+		// thermal modeling: rasterization of blocks and TSVs into power maps;
+		// 2D difference arrays, one for each layer, whereas the additional
+		// row/column captures updates at the maps' upper/right boundaries
+		typedef array<array<double,POWER_MAPS_DIM + 1>,POWER_MAPS_DIM + 1> DiffMap;
+		vector<DiffMap> power_maps_diff;
+		struct BinsSegment {
+			int first;
+			int last;
+			double coverage;
+		};
+		// region of power-map bins, [x_lower, x_upper) x [y_lower, y_upper)
+		struct Region {
+			int x_lower, x_upper;
+			int y_lower, y_upper;
+
+			inline void reset() {
+				this->x_lower = this->y_lower = POWER_MAPS_DIM;
+				this->x_upper = this->y_upper = 0;
+			};
+			inline void setFull() {
+				this->x_lower = this->y_lower = 0;
+				this->x_upper = this->y_upper = POWER_MAPS_DIM;
+			};
+			inline bool empty() const {
+				return (this->x_lower >= this->x_upper || this->y_lower >= this->y_upper);
+			};
+			inline void extend(int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+				if (x_lower >= x_upper || y_lower >= y_upper) {
+					return;
+				}
+				this->x_lower = min(this->x_lower, x_lower);
+				this->x_upper = max(this->x_upper, x_upper);
+				this->y_lower = min(this->y_lower, y_lower);
+				this->y_upper = max(this->y_upper, y_upper);
+			};
+		};
+		void rasterizeRect(DiffMap& diff_map, Rect const& rect, double const& value, Region const& region) const;
+		static int determBinsCoverage(array<BinsSegment,3>& segments, double lower, double upper, int const& limit_lower, int const& limit_upper);
+		static void rasterizeBins(DiffMap& diff_map, int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper, double const& value);
+		static void resetDiffMap(DiffMap& diff_map, Region const& region);
+		static void integrateDiffMap(DiffMap& diff_map, Region const& region);
+		// rounding noise of prefix sums, relative to the largest update of the
+		// difference map
+		static constexpr double RASTERIZATION_NOISE_TOLERANCE = 1.0e-9;
+
+		// thermal modeling: incremental update of power maps; the blocks, TSV
+		// groups and nets' TSVs as rasterized during the previous evaluation
+		// are memorized, and only the region of bins covered by changed ones
+		// is determined again; absent or inactive TSVs are memorized w/ zero
+		// value
+		struct RasterizedRect {
+			Rect bb;
+			int layer;
+			double value;
+		};
+		vector<RasterizedRect> blocks_rasterized;
+		vector<RasterizedRect> TSV_groups_rasterized;
+		// TSVs of net n on layer i are memorized at n * (layers - 1) + i
+		vector<RasterizedRect> nets_TSVs_rasterized;
+		Region power_maps_region;
+		bool power_maps_valid;
+		void memorizeRasterizedRect(RasterizedRect& memorized, Rect const& bb, int const& layer, double const& value);
+		void determNetTSVsBins(Rect const& bb, int& x_lower, int& x_upper, int& y_lower, int& y_upper) const;
+		void updatePowerMaps(int const& layers, MaskParameters const& parameters, Region const& region);
+
+		// thermal modeling: delta updates of thermal map, only for collapsed
+		// power maps; the collapsed power map related to the current thermal
+		// map is memorized, along w/ the difference to its predecessor
+		array<array<double,POWER_MAPS_DIM>,POWER_MAPS_DIM> power_map_collapsed;
+		array<array<double,POWER_MAPS_DIM>,POWER_MAPS_DIM> power_map_delta;
+		bool thermal_map_valid;
+		int thermal_map_delta_updates;
+		// max power density of blocks; reference for tolerance below
+		double power_density_max;
+		// bins of the collapsed power map are considered as changed only for
+		// differences larger than this tolerance, relative to the blocks' max
+		// power density; smaller differences are not memorized, i.e., the
+		// memorized map deviates at most by the tolerance
+		static constexpr double DELTA_UPDATE_TOLERANCE = 1.0e-9;
+		// max ratio of affected thermal-map bins, for larger ratios the full
+		// thermal map is determined
+		static constexpr double DELTA_UPDATE_AREA_LIMIT = 0.5;
+		// max count of subsequent delta updates; avoids accumulation of
+		// rounding errors in thermal map
+		static constexpr int DELTA_UPDATES_LIMIT = 1000;
+
 		// thermal modeling: parameters for generating power maps
 		double power_maps_dim_x, power_maps_dim_y;
 		double power_maps_bin_area;
@@ -194,6 +291,72 @@ class ThermalAnalyzer {
 			}
 		}
 
+		// thermal modeling: separated convolution of power maps into
+		// temporary map (horizontal) and final thermal map (vertical)
+		typedef array<array<double,POWER_MAPS_DIM>,POWER_MAPS_DIM> TempMap;
+		void initThermalMap(MaskParameters const& parameters);
+		// required as buffer for separated convolution; note that its
+		// dimensions corresponds to a power map, which is required to hold
+		// temporary results for 1D convolution of padded power maps
+		TempMap thermal_map_tmp;
+		void blurPowerMapsCollapsed(int const& layers, MaskParameters const& parameters);
+		void blurPowerMapsPerLayer(int const& layers);
+		// convolution kernels; scalar and SIMD implementations, the latter
+		// are compiled for all x86 targets, independent of the compiler flags.
+		// The best implementation supported by the CPU is selected at startup
+		typedef array<double,THERMAL_MASK_DIM> Mask;
+		typedef array<array<double,THERMAL_MAP_DIM>,THERMAL_MAP_DIM> ThermalMap;
+		struct Kernels {
+			void (*convoluteHorizontal)(TempMap const& input, Mask const& mask, TempMap& output,
+					int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper);
+			void (*convoluteVertical)(TempMap const& input, Mask const& mask, double const& scale, ThermalMap& output,
+					int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper);
+			void (*determMaxAvgTemp)(ThermalMap const& map, double& max_temp, double& avg_temp);
+		};
+		static Kernels selectKernels();
+		inline static Kernels const& kernels() {
+
+			// kernels are selected once, during first call; thread-safe
+			// initialization of static local variables is guaranteed by C++11
+			static Kernels const kernels = ThermalAnalyzer::selectKernels();
+
+			return kernels;
+		};
+		inline static void convoluteHorizontal(TempMap const& input, Mask const& mask, TempMap& output,
+				int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+			ThermalAnalyzer::kernels().convoluteHorizontal(input, mask, output, x_lower, x_upper, y_lower, y_upper);
+		};
+		inline void convoluteVertical(TempMap const& input, Mask const& mask, double const& scale,
+				int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper) {
+			ThermalAnalyzer::kernels().convoluteVertical(input, mask, scale, this->thermal_map, x_lower, x_upper, y_lower, y_upper);
+		};
+		inline void determMaxAvgTemp(double& max_temp, double& avg_temp) const {
+			ThermalAnalyzer::kernels().determMaxAvgTemp(this->thermal_map, max_temp, avg_temp);
+		};
+		static void convoluteHorizontalScalar(TempMap const& input, Mask const& mask, TempMap& output,
+				int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper);
+		static void convoluteVerticalScalar(TempMap const& input, Mask const& mask, double const& scale, ThermalMap& output,
+				int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper);
+		static void determMaxAvgTempScalar(ThermalMap const& map, double& max_temp, double& avg_temp);
+#if defined(__x86_64__) || defined(__i386__)
+		__attribute__((target("avx2")))
+		static void convoluteHorizontalAVX2(TempMap const& input, Mask const& mask, TempMap& output,
+				int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper);
+		__attribute__((target("avx2")))
+		static void convoluteVerticalAVX2(TempMap const& input, Mask const& mask, double const& scale, ThermalMap& output,
+				int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper);
+		__attribute__((target("avx2")))
+		static void determMaxAvgTempAVX2(ThermalMap const& map, double& max_temp, double& avg_temp);
+		__attribute__((target("avx512f")))
+		static void convoluteHorizontalAVX512(TempMap const& input, Mask const& mask, TempMap& output,
+				int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper);
+		__attribute__((target("avx512f")))
+		static void convoluteVerticalAVX512(TempMap const& input, Mask const& mask, double const& scale, ThermalMap& output,
+				int const& x_lower, int const& x_upper, int const& y_lower, int const& y_upper);
+		__attribute__((target("avx512f")))
+		static void determMaxAvgTempAVX512(ThermalMap const& map, double& max_temp, double& avg_temp);
+#endif
+
 	// constructors, destructors, if any non-implicit
 	public:
 
@@ -0,0 +1,158 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Corblivar thread pool, for concurrent handling of independent tasks
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+#ifndef _CORBLIVAR_THREAD_POOL
+#define _CORBLIVAR_THREAD_POOL
+
+// library includes
+#include "Corblivar.incl.hpp"
+// Corblivar includes, if any
+// forward declarations, if any
+
+// Persistent pool of worker threads; runs a set of independent tasks, referred to by
+// their index, concurrently. The calling thread handles tasks as well and returns once
+// all tasks are done. The workers are kept waiting in between, thus avoiding the
+// overhead of starting threads for each set of tasks
+class ThreadPool {
+	// private data, functions
+	private:
+		vector<thread> workers;
+
+		mutex m;
+		condition_variable cv_start, cv_done;
+
+		// current set of tasks; the generation is increased for each set, such
+		// that waiting workers can recognize new tasks
+		function<void(unsigned const&)> const* task;
+		unsigned tasks;
+		unsigned next_task;
+		unsigned pending_tasks;
+		unsigned generation;
+		bool stop;
+
+		// handle tasks of current set, until all are assigned; the lock has
+		// to be held when called, and is held again on return
+		inline void handleTasks(unique_lock<mutex>& lock) {
+			unsigned t;
+
+			while (this->next_task < this->tasks) {
+
+				t = this->next_task;
+				this->next_task++;
+
+				lock.unlock();
+				(*this->task)(t);
+				lock.lock();
+
+				this->pending_tasks--;
+			}
+		};
+
+		// worker loop
+		inline void work() {
+			unsigned generation = 0;
+			unique_lock<mutex> lock(this->m);
+
+			while (true) {
+
+				// wait for new set of tasks
+				this->cv_start.wait(lock, [&]() {
+					return this->stop || this->generation != generation;
+				});
+
+				if (this->stop) {
+					return;
+				}
+
+				generation = this->generation;
+
+				this->handleTasks(lock);
+
+				// notify calling thread once all tasks are done
+				if (this->pending_tasks == 0) {
+					this->cv_done.notify_one();
+				}
+			}
+		};
+
+	// constructors, destructors, if any non-implicit
+	public:
+		ThreadPool(unsigned const& threads) {
+
+			this->task = nullptr;
+			this->tasks = this->next_task = this->pending_tasks = 0;
+			this->generation = 0;
+			this->stop = false;
+
+			for (unsigned i = 0; i < threads; i++) {
+				this->workers.push_back(thread(&ThreadPool::work, this));
+			}
+		};
+
+		~ThreadPool() {
+
+			{
+				lock_guard<mutex> lock(this->m);
+				this->stop = true;
+			}
+			this->cv_start.notify_all();
+
+			for (thread& th : this->workers) {
+				th.join();
+			}
+		};
+
+		// workers refer to the pool itself, thus it shall not be copied
+		ThreadPool(ThreadPool const&) = delete;
+		ThreadPool& operator=(ThreadPool const&) = delete;
+
+	// public data, functions
+	public:
+		// count of threads handling tasks, i.e., the workers and the calling
+		// thread
+		inline unsigned threads() const {
+			return this->workers.size() + 1;
+		};
+
+		// run tasks [0, tasks) concurrently; returns once all tasks are done
+		inline void run(unsigned const& tasks, function<void(unsigned const&)> const& task) {
+			unique_lock<mutex> lock(this->m);
+
+			this->task = &task;
+			this->tasks = tasks;
+			this->next_task = 0;
+			this->pending_tasks = tasks;
+			this->generation++;
+
+			this->cv_start.notify_all();
+
+			// handle tasks in calling thread as well
+			this->handleTasks(lock);
+
+			// wait for tasks still handled by workers
+			this->cv_done.wait(lock, [&]() {
+				return this->pending_tasks == 0;
+			});
+		};
+};
+
+#endif
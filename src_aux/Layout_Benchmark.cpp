@@ -0,0 +1,104 @@
+/*
+ * =====================================================================================
+ *
+ *    Description:  Benchmark for layout generation, i.e., throughput of CorblivarCore::generateLayout
+ *
+ *    Copyright (C) 2013 Johann Knechtel, johann.knechtel@ifte.de, www.ifte.de
+ *
+ *    This file is part of Corblivar.
+ *    
+ *    Corblivar is free software: you can redistribute it and/or modify it under the terms
+ *    of the GNU General Public License as published by the Free Software Foundation,
+ *    either version 3 of the License, or (at your option) any later version.
+ *    
+ *    Corblivar is distributed in the hope that it will be useful, but WITHOUT ANY
+ *    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ *    PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+ *    
+ *    You should have received a copy of the GNU General Public License along with
+ *    Corblivar.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * =====================================================================================
+ */
+
+// required Corblivar headers
+#include "../src/CorblivarCore.hpp"
+#include "../src/FloorPlanner.hpp"
+#include "../src/IO.hpp"
+
+// usage as for Corblivar itself, i.e., w/ benchmark name, config file and benchmarks
+// directory; the technology file is expected next to the config file. Note that the
+// default exp/Technology.conf is only suitable for the n100 and n200 benchmarks; the
+// layout generation itself is not affected by the die outline, but the parser rejects
+// benchmarks not fitting into it ("Chip too small"). The following adaptations of the
+// technology file are required:
+//  n300: fixed die outline of 20000um x 20000um
+//  ami49, ibm01: fixed die outline of 20000um x 20000um, and scaling factor for
+//  block dimensions of 1
+
+// count of random CBL data sets, and count of layouts generated for each set
+static constexpr int RANDOM_DATA_SETS = 10;
+static constexpr int LAYOUTS_PER_SET = 1000;
+
+int main (int argc, char** argv) {
+	FloorPlanner fp;
+	struct timeb start, end;
+	double runtime;
+	bool perform_alignment;
+	int layouts;
+
+	cout << endl;
+	cout << "Layout Generation Benchmark" << endl;
+	cout << endl;
+
+	// parse program parameter, config file, and further files
+	IO::parseParametersFiles(fp, argc, argv);
+	// parse blocks
+	IO::parseBlocks(fp);
+	// parse nets
+	IO::parseNets(fp);
+
+	// init Corblivar core
+	CorblivarCore corb = CorblivarCore(fp.getLayers(), fp.getBlocks().size());
+
+	// parse alignment request
+	IO::parseAlignmentRequests(fp, corb.editAlignments());
+	// init related adjacency of blocks and alignment requests
+	corb.initAlignmentReqsAdjacency(fp.getBlocks().size());
+	// init thread pool for concurrent handling of dies
+	corb.initThreadPool();
+
+	// consider alignment requests during layout generation, if any
+	perform_alignment = !corb.getAlignments().empty();
+
+	// generate layouts for multiple random data sets; only the layout generation
+	// itself is timed
+	runtime = 0.0;
+	layouts = 0;
+	for (int set = 0; set < RANDOM_DATA_SETS; set++) {
+
+		// generate new, random data set; consider separate copy of (so far
+		// empty) core since data are appended to the CBLs
+		CorblivarCore corb_set = corb;
+		corb_set.initCorblivarRandomly(false, fp.getLayers(), fp.getBlocks(), fp.powerAwareBlockHandling());
+
+		ftime(&start);
+
+		for (int l = 0; l < LAYOUTS_PER_SET; l++) {
+			corb_set.generateLayout(perform_alignment);
+		}
+
+		ftime(&end);
+
+		runtime += (1000.0 * (end.time - start.time) + (end.millitm - start.millitm)) / 1000.0;
+		layouts += LAYOUTS_PER_SET;
+	}
+
+	cout << "Benchmark> ";
+	cout << "Benchmark: " << fp.getBenchmark() << ", alignment handling: " << perform_alignment << endl;
+	cout << "Benchmark> ";
+	cout << "Generated layouts: " << layouts << ", runtime: " << runtime << " s" << endl;
+	cout << "Benchmark> ";
+	cout << "Throughput: " << layouts / runtime << " layouts/s" << endl;
+	cout << endl;
+}